@@ -61,6 +61,7 @@ FHoudiniRuntimeSettingsDetails::CustomizeDetails( IDetailLayoutBuilder & DetailB
     DetailBuilder.EditCategory( "Parameters", FText::GetEmpty(), ECategoryPriority::Important );
     DetailBuilder.EditCategory( "CollisionGeneration", FText::GetEmpty(), ECategoryPriority::Important );
     DetailBuilder.EditCategory( "GeometryMarshalling", FText::GetEmpty(), ECategoryPriority::Important );
+    DetailBuilder.EditCategory( "Instancing", FText::GetEmpty(), ECategoryPriority::Important );
     DetailBuilder.EditCategory( "GeometryScalingAndImport", FText::GetEmpty(), ECategoryPriority::Important );
     DetailBuilder.EditCategory( "GeneratedStaticMeshSettings", FText::GetEmpty(), ECategoryPriority::Important );
     DetailBuilder.EditCategory( "StaticMeshBuildSettings", FText::GetEmpty(), ECategoryPriority::Important );
@@ -69,6 +69,8 @@
 #include "UObjectToken.h"
 #include "LandscapeInfo.h"
 #include "LandscapeLayerInfoObject.h"
+#include "LandscapeStreamingProxy.h"
+#include "Async/ParallelFor.h"
 #include "Engine/StaticMeshSocket.h"
 #include "MessageDialog.h"
 #include "Widgets/Input/SButton.h"
@@ -363,6 +365,8 @@ UHoudiniAssetComponent::UHoudiniAssetComponent( const FObjectInitializer & Objec
     ComponentGUID = FGuid::NewGuid();
 
     bEditorPropertiesNeedFullUpdate = true;
+
+    ParameterLayoutHash = 0;
 }
 
 UHoudiniAssetComponent::~UHoudiniAssetComponent()
@@ -2050,6 +2054,15 @@ UHoudiniAssetComponent::SubscribeEditorDelegates()
     {
         GEditor->OnActorMoved().AddUObject( this, &UHoudiniAssetComponent::OnActorMoved );
     }
+
+    // Add delegates for asset registry changes, they invalidate the missing attribute materials.
+    FAssetRegistryModule & AssetRegistryModule =
+        FModuleManager::LoadModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) );
+
+    DelegateHandleAssetRegistryAssetAdded = AssetRegistryModule.Get().OnAssetAdded().AddUObject(
+        this, &UHoudiniAssetComponent::OnAssetRegistryAssetAdded );
+    DelegateHandleAssetRegistryAssetRenamed = AssetRegistryModule.Get().OnAssetRenamed().AddUObject(
+        this, &UHoudiniAssetComponent::OnAssetRegistryAssetRenamed );
 }
 
 void
@@ -2065,6 +2078,28 @@ UHoudiniAssetComponent::UnsubscribeEditorDelegates()
     {
         GEditor->OnActorMoved().RemoveAll( this );
     }
+
+    // Remove asset registry delegates, the module may already be unloaded on shutdown.
+    if ( FModuleManager::Get().IsModuleLoaded( TEXT( "AssetRegistry" ) ) )
+    {
+        FAssetRegistryModule & AssetRegistryModule =
+            FModuleManager::GetModuleChecked< FAssetRegistryModule >( TEXT( "AssetRegistry" ) );
+
+        AssetRegistryModule.Get().OnAssetAdded().Remove( DelegateHandleAssetRegistryAssetAdded );
+        AssetRegistryModule.Get().OnAssetRenamed().Remove( DelegateHandleAssetRegistryAssetRenamed );
+    }
+}
+
+void
+UHoudiniAssetComponent::OnAssetRegistryAssetAdded( const FAssetData & AssetData )
+{
+    MissingAttributeMaterials.Empty();
+}
+
+void
+UHoudiniAssetComponent::OnAssetRegistryAssetRenamed( const FAssetData & AssetData, const FString & OldObjectPath )
+{
+    MissingAttributeMaterials.Empty();
 }
 
 void
@@ -2705,7 +2740,12 @@ UHoudiniAssetComponent::OnComponentDestroyed( bool bDestroyingHierarchy )
     // Destroy all inputs.
     ClearInputs();
 
-    // Destroy all instance inputs.
+    // Destroy all instance inputs, along with the foliage they generated.
+    for ( UHoudiniAssetInstanceInput * InstanceInput : InstanceInputs )
+    {
+        if ( InstanceInput )
+            InstanceInput->ClearFoliageInstances();
+    }
     ClearInstanceInputs();
 
     // Destroy all handles.
@@ -2998,6 +3038,10 @@ UHoudiniAssetComponent::Serialize( FArchive & Ar )
     // Serialize parameters.
     SerializeParameters( Ar );
 
+    // Loaded parameters have to be rebuilt by the next cook.
+    if ( Ar.IsLoading() )
+        ParameterLayoutHash = 0;
+
     // Serialize parameters name map.
     if ( HoudiniAssetComponentVersion >= VER_HOUDINI_ENGINE_COMPONENT_PARAMETER_NAME_MAP )
     {
@@ -3705,6 +3749,22 @@ UHoudiniAssetComponent::CreateCurves( const TArray< FHoudiniGeoPartObject > & Fo
 void
 UHoudiniAssetComponent::CreateParameters()
 {
+    // Most cooks don't change the parameter interface, the parameters are kept when their layout is the same.
+    // Callbacks and expressions can still change their values, which are all refreshed at once.
+    uint32 NewParameterLayoutHash = 0;
+    bool bHasLayoutHash = FHoudiniParamUtils::GetParameterLayoutHash( AssetId, NewParameterLayoutHash );
+    if ( bHasLayoutHash && ParameterLayoutHash != 0 && NewParameterLayoutHash == ParameterLayoutHash )
+    {
+        bool bValuesChanged = false;
+        if ( FHoudiniParamUtils::RefreshValues( AssetId, Parameters, bValuesChanged ) )
+        {
+            if ( bValuesChanged )
+                bEditorPropertiesNeedFullUpdate = true;
+
+            return;
+        }
+    }
+
     TMap< HAPI_ParmId, class UHoudiniAssetParameter * > NewParameters;
 
     bool Ok = FHoudiniParamUtils::Build( AssetId, this, Parameters, NewParameters );
@@ -3721,6 +3781,8 @@ UHoudiniAssetComponent::CreateParameters()
         {
             ParameterByName.Add( ParmPair.Value->GetParameterName(), ParmPair.Value );
         }
+
+        ParameterLayoutHash = bHasLayoutHash ? NewParameterLayoutHash : 0;
     }
 }
 
@@ -4314,9 +4376,7 @@ void UHoudiniAssetComponent::GetHeightFieldLandscapeMaterials(
         if ( AttribMaterials.exists && Materials.Num() > 0 )
         {
             // Load the material
-            LandscapeMaterial = Cast< UMaterialInterface >( StaticLoadObject(
-                UMaterialInterface::StaticClass(),
-                nullptr, *( Materials[ 0 ] ), nullptr, LOAD_NoWarn, nullptr ) );
+            LandscapeMaterial = LoadAttributeMaterial( Materials[ 0 ] );
 
             if ( LandscapeMaterial )
             {
@@ -4351,9 +4411,7 @@ void UHoudiniAssetComponent::GetHeightFieldLandscapeMaterials(
         if ( AttribMaterials.exists && Materials.Num() > 0 )
         {
             // Load the material
-            LandscapeHoleMaterial = Cast< UMaterialInterface >( StaticLoadObject(
-                UMaterialInterface::StaticClass(),
-                nullptr, *( Materials[ 0 ] ), nullptr, LOAD_NoWarn, nullptr ) );
+            LandscapeHoleMaterial = LoadAttributeMaterial( Materials[ 0 ] );
 
             if ( LandscapeHoleMaterial )
             {
@@ -4429,49 +4487,73 @@ UHoudiniAssetComponent::CreateAllLandscapes( const TArray< FHoudiniGeoPartObject
         UMaterialInterface* LandscapeHoleMaterial = nullptr;
         GetHeightFieldLandscapeMaterials( *CurrentHeightfield, LandscapeMaterial, LandscapeHoleMaterial );
 
-        // Extract the Float Data from the Heightfield
-        TArray< float > FloatValues;
         HAPI_VolumeInfo VolumeInfo;
-        float FloatMin, FloatMax;
-        if ( !FHoudiniLandscapeUtils::ExtractHeightfieldData( *CurrentHeightfield, FloatValues, VolumeInfo, FloatMin, FloatMax ) )
+        if ( !FHoudiniLandscapeUtils::GetHeightfieldVolumeInfo( *CurrentHeightfield, VolumeInfo ) )
             continue;
 
-        // Do we need to convert the heightfields using the same global Min/Max
-        if ( fGlobalMin != fGlobalMax )
-        {
-            FloatMin = fGlobalMin;
-            FloatMax = fGlobalMax;
-        }
+        // Very large heightfields are split in tiles instead of being resampled to fit a single landscape
+        int32 TileSize = 0;
+        bool bTiled = FHoudiniLandscapeUtils::ShouldTileLandscape( VolumeInfo, TileSize );
 
-        // Convert the height data from Houdini's heightfield to Unreal's Landscape
+        // Convert the height data from Houdini's heightfield to Unreal's Landscape, using the global
+        // Min/Max if there are multiple heightfields, or the heightfield's own range otherwise
         TArray< uint16 > IntHeightData;
         FTransform LandscapeTransform;
         int32 XSize, YSize, NumSectionPerLandscapeComponent, NumQuadsPerLandscapeSection;
-        if ( !FHoudiniLandscapeUtils::ConvertHeightfieldDataToLandscapeData(
-            FloatValues, VolumeInfo, FloatMin, FloatMax,
+        if ( !FHoudiniLandscapeUtils::ExtractHeightfieldLandscapeData(
+            *CurrentHeightfield, VolumeInfo, fGlobalMin, fGlobalMax,
             IntHeightData, LandscapeTransform,
             XSize, YSize,
             NumSectionPerLandscapeComponent,
-            NumQuadsPerLandscapeSection ) )
+            NumQuadsPerLandscapeSection,
+            bTiled ) )
             continue;
 
         // Look for all the layers/masks corresponding to the current heightfield
         TArray< const FHoudiniGeoPartObject* > FoundLayers;
         FHoudiniLandscapeUtils::GetHeightfieldsLayersInArray( FoundVolumes, *CurrentHeightfield, FoundLayers );
 
+        // If the previous landscape for this heightfield has the same size and transform, we can update it in place
+        ALandscape * PreviousLandscape = LandscapeComponents.FindRef( *CurrentHeightfield );
+        if ( bTiled || !FHoudiniLandscapeUtils::CanUpdateLandscape(
+            PreviousLandscape, XSize, YSize,
+            NumSectionPerLandscapeComponent, NumQuadsPerLandscapeSection,
+            LandscapeTransform ) )
+            PreviousLandscape = nullptr;
+
         // Extract and convert the Landscape layers
         TArray< FLandscapeImportLayerInfo > ImportLayerInfos;
         if ( !CreateLandscapeLayers( FoundLayers, *CurrentHeightfield,
-            XSize, YSize, ImportLayerInfos ) )
+            XSize, YSize, ImportLayerInfos, PreviousLandscape ) )
             continue;
 
-        // Create the actual Landscape
-        ALandscape * CurrentLandscape = CreateLandscape( 
-            IntHeightData, ImportLayerInfos,
-            LandscapeTransform,
-            XSize, YSize,
-            NumSectionPerLandscapeComponent, NumQuadsPerLandscapeSection,
-            LandscapeMaterial, LandscapeHoleMaterial );
+        // Create the actual Landscape, or only write the modified components of the previous one
+        ALandscape * CurrentLandscape = nullptr;
+        if ( PreviousLandscape && FHoudiniLandscapeUtils::UpdateLandscapeData(
+            PreviousLandscape, IntHeightData, ImportLayerInfos, XSize, YSize ) )
+        {
+            CurrentLandscape = PreviousLandscape;
+            UpdateLandscapeMaterials( CurrentLandscape, LandscapeMaterial, LandscapeHoleMaterial );
+        }
+        else if ( bTiled )
+        {
+            CurrentLandscape = CreateTiledLandscape(
+                IntHeightData, ImportLayerInfos,
+                LandscapeTransform,
+                XSize, YSize,
+                NumSectionPerLandscapeComponent, NumQuadsPerLandscapeSection,
+                TileSize,
+                LandscapeMaterial, LandscapeHoleMaterial );
+        }
+        else
+        {
+            CurrentLandscape = CreateLandscape(
+                IntHeightData, ImportLayerInfos,
+                LandscapeTransform,
+                XSize, YSize,
+                NumSectionPerLandscapeComponent, NumQuadsPerLandscapeSection,
+                LandscapeMaterial, LandscapeHoleMaterial );
+        }
 
         if ( !CurrentLandscape )
             continue;
@@ -4480,6 +4562,13 @@ UHoudiniAssetComponent::CreateAllLandscapes( const TArray< FHoudiniGeoPartObject
         NewLandscapes.Add( *CurrentHeightfield, CurrentLandscape );
     }
 
+    // Landscapes that were updated in place must not be destroyed with the old ones
+    for ( TMap< FHoudiniGeoPartObject, ALandscape * >::TIterator Iter( NewLandscapes ); Iter; ++Iter )
+    {
+        if ( LandscapeComponents.FindRef( Iter.Key() ) == Iter.Value() )
+            LandscapeComponents.Remove( Iter.Key() );
+    }
+
     // Replace the old landscapes with the new ones
     ClearLandscapes();
     LandscapeComponents = NewLandscapes;
@@ -4492,10 +4581,14 @@ bool UHoudiniAssetComponent::CreateLandscapeLayers(
     const TArray< const FHoudiniGeoPartObject* >& FoundLayers,
     const FHoudiniGeoPartObject& Heightfield,
     const int32& LandscapeXSize, const int32& LandscapeYSize,
-    TArray<FLandscapeImportLayerInfo>& ImportLayerInfos )
+    TArray<FLandscapeImportLayerInfo>& ImportLayerInfos,
+    ALandscape * ExistingLandscape )
 {
     ImportLayerInfos.Empty();
 
+    // When updating a landscape, its layer info objects are reused
+    ULandscapeInfo * ExistingLandscapeInfo = ExistingLandscape ? ExistingLandscape->GetLandscapeInfo() : nullptr;
+
     // Try to create all the layers
 
     ELandscapeImportAlphamapType ImportLayerType = ELandscapeImportAlphamapType::Additive;
@@ -4511,12 +4604,19 @@ bool UHoudiniAssetComponent::CreateLandscapeLayers(
         if ( LayerGeoPartObject->AssetId == -1 )
             continue;
 
-        TArray< float > FloatLayerData;
         HAPI_VolumeInfo LayerVolumeInfo;
         float LayerMin = 0;
         float LayerMax = 0;
 
-        if ( !FHoudiniLandscapeUtils::ExtractHeightfieldData( *LayerGeoPartObject, FloatLayerData, LayerVolumeInfo, LayerMin, LayerMax ) )
+        if ( !FHoudiniLandscapeUtils::GetHeightfieldVolumeInfo( *LayerGeoPartObject, LayerVolumeInfo ) )
+            continue;
+
+        // Convert the float data to uint8, the layer is only fetched once
+        TArray< uint8 > LayerData;
+        if ( !FHoudiniLandscapeUtils::ExtractHeightfieldLayerData(
+            *LayerGeoPartObject, LayerVolumeInfo,
+            LandscapeXSize, LandscapeYSize,
+            LayerData, LayerMin, LayerMax ) )
             continue;
 
         // No need to create flat layers as Unreal will remove them afterwards..
@@ -4531,21 +4631,22 @@ bool UHoudiniAssetComponent::CreateLandscapeLayers(
         FName LayerName( *LayerString );
         FLandscapeImportLayerInfo currentLayerInfo( LayerName );
 
-        UPackage * Package;
-        currentLayerInfo.LayerInfo = CreateLandscapeLayerInfoObject( LayerString.GetCharArray().GetData(), Package );
-        if ( !currentLayerInfo.LayerInfo || !Package )
-            continue;
+        UPackage * Package = nullptr;
+        int32 ExistingLayerIndex = ExistingLandscapeInfo ? ExistingLandscapeInfo->GetLayerInfoIndex( LayerName ) : INDEX_NONE;
+        if ( ExistingLayerIndex != INDEX_NONE )
+            currentLayerInfo.LayerInfo = ExistingLandscapeInfo->Layers[ ExistingLayerIndex ].LayerInfoObj;
 
-        // Convert the float data to uint8
-        if ( !FHoudiniLandscapeUtils::ConvertHeightfieldLayerToLandscapeLayer(
-            FloatLayerData, LayerVolumeInfo.xLength, LayerVolumeInfo.yLength,
-            LayerMin, LayerMax,
-            LandscapeXSize, LandscapeYSize,
-            currentLayerInfo.LayerData ) )
-            continue;
+        if ( !currentLayerInfo.LayerInfo )
+        {
+            currentLayerInfo.LayerInfo = CreateLandscapeLayerInfoObject( LayerString.GetCharArray().GetData(), Package );
+            if ( !currentLayerInfo.LayerInfo || !Package )
+                continue;
+        }
+
+        currentLayerInfo.LayerData = MoveTemp( LayerData );
 
-        // Should remove package if convert fail!
-        CookedTemporaryLandscapeLayers.Add( Package, Heightfield );
+        if ( Package )
+            CookedTemporaryLandscapeLayers.Add( Package, Heightfield );
 
         currentLayerInfo.LayerInfo->bNoWeightBlend = false;
 
@@ -4564,6 +4665,33 @@ bool UHoudiniAssetComponent::CreateLandscapeLayers(
 }
 
 
+void
+UHoudiniAssetComponent::UpdateLandscapeMaterials(
+    ALandscape * Landscape,
+    UMaterialInterface* LandscapeMaterial, UMaterialInterface* LandscapeHoleMaterial )
+{
+    if ( !Landscape )
+        return;
+
+    bool bMaterialChanged = false;
+    if ( LandscapeMaterial && ( Landscape->LandscapeMaterial != LandscapeMaterial ) )
+    {
+        Landscape->LandscapeMaterial = LandscapeMaterial;
+        bMaterialChanged = true;
+    }
+
+    if ( LandscapeHoleMaterial && ( Landscape->LandscapeHoleMaterial != LandscapeHoleMaterial ) )
+    {
+        Landscape->LandscapeHoleMaterial = LandscapeHoleMaterial;
+        bMaterialChanged = true;
+    }
+
+    // Only rebuild the material instances if needed
+    if ( bMaterialChanged )
+        Landscape->UpdateAllComponentMaterialInstances();
+}
+
+
 ALandscape *
 UHoudiniAssetComponent::CreateLandscape(
     const TArray< uint16 >& IntHeightData,
@@ -4672,6 +4800,159 @@ UHoudiniAssetComponent::CreateLandscape(
 }
 
 
+ALandscape *
+UHoudiniAssetComponent::CreateTiledLandscape(
+    TArray< uint16 >& IntHeightData,
+    TArray< FLandscapeImportLayerInfo >& ImportLayerInfos,
+    const FTransform& LandscapeTransform,
+    const int32& XSize, const int32& YSize,
+    const int32& NumSectionPerLandscapeComponent, const int32& NumQuadsPerLandscapeSection,
+    const int32& TileSize,
+    UMaterialInterface* LandscapeMaterial, UMaterialInterface* LandscapeHoleMaterial )
+{
+    if ( ( XSize < 2 ) || ( YSize < 2 ) )
+        return nullptr;
+
+    if ( IntHeightData.Num() != ( XSize * YSize ) )
+        return nullptr;
+
+    if ( !GEditor )
+        return nullptr;
+
+    UWorld* MyWorld = GEditor->GetEditorWorldContext().World();
+    if ( !MyWorld )
+        return nullptr;
+
+    // Tiles are made of whole components
+    const int32 QuadsPerComponent = NumSectionPerLandscapeComponent * NumQuadsPerLandscapeSection;
+    const int32 TileQuads = FMath::Max( 1, ( TileSize - 1 ) / QuadsPerComponent ) * QuadsPerComponent;
+    const int32 TileCountX = FMath::DivideAndRoundUp( XSize - 1, TileQuads );
+    const int32 TileCountY = FMath::DivideAndRoundUp( YSize - 1, TileQuads );
+
+    // The first tile is imported in the landscape actor itself, the other ones in streaming proxies.
+    ALandscape* Landscape = MyWorld->SpawnActor< ALandscape >();
+    if ( !Landscape )
+        return nullptr;
+
+    FGuid currentGUID = FGuid::NewGuid();
+    Landscape->SetLandscapeGuid( currentGUID );
+    Landscape->SetActorTransform( LandscapeTransform );
+
+    // Deactivate CastStaticShadow on the landscape to avoid "grid shadow" issue
+    Landscape->bCastStaticShadow = false;
+
+    if ( LandscapeMaterial )
+        Landscape->LandscapeMaterial = LandscapeMaterial;
+
+    if ( LandscapeHoleMaterial )
+        Landscape->LandscapeHoleMaterial = LandscapeHoleMaterial;
+
+    // Same lighting LOD heuristic as CreateLandscape, but for the tile size
+    const int32 FullTileSize = ( TileQuads + 1 ) * ( TileQuads + 1 );
+    Landscape->StaticLightingLOD = FMath::DivideAndRoundUp( FMath::CeilLogTwo( FullTileSize / ( 2048 * 2048 ) + 1 ), ( uint32 )2 );
+
+    ELandscapeImportAlphamapType ImportLayerType = ELandscapeImportAlphamapType::Additive;
+
+    // The asset needs to be static in order to attach the landscape to it
+    SetMobility( EComponentMobility::Static );
+
+    // Tiles are converted one row of tiles at a time: the row's tiles are sliced in parallel into their own
+    // buffers, then imported on the game thread. Only one row of tiles is alive next to the source data.
+    TArray< TArray< uint16 > > TileHeightData;
+    TArray< TArray< FLandscapeImportLayerInfo > > TileImportLayerInfos;
+    for ( int32 TileY = 0; TileY < TileCountY; TileY++ )
+    {
+        // Neighbouring tiles share their border vertices
+        const int32 MinY = TileY * TileQuads;
+        const int32 MaxY = FMath::Min( MinY + TileQuads, YSize - 1 );
+        const int32 TileYSize = MaxY - MinY + 1;
+
+        TileHeightData.SetNum( TileCountX );
+        TileImportLayerInfos.SetNum( TileCountX );
+        ParallelFor( TileCountX, [&]( int32 TileX )
+        {
+            const int32 MinX = TileX * TileQuads;
+            const int32 MaxX = FMath::Min( MinX + TileQuads, XSize - 1 );
+            const int32 TileXSize = MaxX - MinX + 1;
+
+            // Slice the tile's height and layer data, one row at a time
+            TArray< uint16 >& HeightData = TileHeightData[ TileX ];
+            HeightData.SetNumUninitialized( TileXSize * TileYSize );
+            for ( int32 nY = 0; nY < TileYSize; nY++ )
+            {
+                FMemory::Memcpy(
+                    &HeightData[ nY * TileXSize ],
+                    &IntHeightData[ MinX + ( MinY + nY ) * XSize ],
+                    TileXSize * sizeof( uint16 ) );
+            }
+
+            TArray< FLandscapeImportLayerInfo >& LayerInfos = TileImportLayerInfos[ TileX ];
+            LayerInfos.Reset( ImportLayerInfos.Num() );
+            for ( const FLandscapeImportLayerInfo& ImportLayerInfo : ImportLayerInfos )
+            {
+                FLandscapeImportLayerInfo TileLayerInfo( ImportLayerInfo.LayerName );
+                TileLayerInfo.LayerInfo = ImportLayerInfo.LayerInfo;
+                TileLayerInfo.SourceFilePath = ImportLayerInfo.SourceFilePath;
+
+                if ( ImportLayerInfo.LayerData.Num() == XSize * YSize )
+                {
+                    TileLayerInfo.LayerData.SetNumUninitialized( TileXSize * TileYSize );
+                    for ( int32 nY = 0; nY < TileYSize; nY++ )
+                    {
+                        FMemory::Memcpy(
+                            &TileLayerInfo.LayerData[ nY * TileXSize ],
+                            &ImportLayerInfo.LayerData[ MinX + ( MinY + nY ) * XSize ],
+                            TileXSize * sizeof( uint8 ) );
+                    }
+                }
+
+                LayerInfos.Add( MoveTemp( TileLayerInfo ) );
+            }
+        } );
+
+        for ( int32 TileX = 0; TileX < TileCountX; TileX++ )
+        {
+            const int32 MinX = TileX * TileQuads;
+            const int32 MaxX = FMath::Min( MinX + TileQuads, XSize - 1 );
+
+            // The first tile is imported in the landscape actor, the proxies then copy its shared properties
+            ALandscapeProxy* TileProxy = Landscape;
+            if ( TileX != 0 || TileY != 0 )
+            {
+                ALandscapeStreamingProxy* StreamingProxy = MyWorld->SpawnActor< ALandscapeStreamingProxy >();
+                if ( !StreamingProxy )
+                    continue;
+
+                StreamingProxy->GetSharedProperties( Landscape );
+                StreamingProxy->LandscapeActor = Landscape;
+                StreamingProxy->SetActorTransform( LandscapeTransform );
+                TileProxy = StreamingProxy;
+            }
+
+            // Tile coordinates are global, so all proxies end up in the same landscape space
+            TileProxy->Import(
+                currentGUID,
+                MinX, MinY, MaxX, MaxY,
+                NumSectionPerLandscapeComponent, NumQuadsPerLandscapeSection,
+                TileHeightData[ TileX ].GetData(), NULL,
+                TileImportLayerInfos[ TileX ], ImportLayerType );
+
+            TileProxy->AttachToComponent( this, FAttachmentTransformRules::KeepRelativeTransform );
+            TileProxy->RegisterAllComponents();
+
+            // The tile's buffers are reused by the next row of tiles
+            TileHeightData[ TileX ].Reset();
+            TileImportLayerInfos[ TileX ].Reset();
+        }
+    }
+
+    // The source data is released at once, shrinking it after each row would copy the remaining rows every time
+    IntHeightData.Empty();
+    ImportLayerInfos.Empty();
+
+    return Landscape;
+}
+
 ULandscapeLayerInfoObject *
 UHoudiniAssetComponent::CreateLandscapeLayerInfoObject( const TCHAR* LayerName, UPackage*& Package)
 {
@@ -4750,6 +5031,22 @@ UHoudiniAssetComponent::ClearLandscapes()
         if ( !HoudiniLandscape )
             continue;
 
+#if WITH_EDITOR
+        // Tiled landscapes also own streaming proxies
+        if ( ULandscapeInfo* LandscapeInfo = HoudiniLandscape->GetLandscapeInfo() )
+        {
+            TArray< ALandscapeStreamingProxy* > Proxies = LandscapeInfo->Proxies.Array();
+            for ( ALandscapeStreamingProxy* Proxy : Proxies )
+            {
+                if ( !Proxy )
+                    continue;
+
+                Proxy->UnregisterAllComponents();
+                Proxy->Destroy();
+            }
+        }
+#endif
+
         //HoudiniLandscape->DetachFromComponent( FDetachmentTransformRules::KeepRelativeTransform );
         HoudiniLandscape->UnregisterAllComponents();
         HoudiniLandscape->Destroy();
@@ -4775,6 +5072,7 @@ UHoudiniAssetComponent::ClearParameters()
 
     Parameters.Empty();
     ParameterByName.Empty();
+    ParameterLayoutHash = 0;
 }
 
 void
@@ -5215,6 +5513,27 @@ UHoudiniAssetComponent::AddAssignmentMaterial( const FString& MaterialName, UMat
     }
 }
 
+UMaterialInterface *
+UHoudiniAssetComponent::LoadAttributeMaterial( const FString& MaterialPath )
+{
+    // Paths that failed to load are not retried until an asset is added or renamed.
+    if ( MissingAttributeMaterials.Contains( MaterialPath ) )
+        return nullptr;
+
+    TWeakObjectPtr< UMaterialInterface > & AttributeMaterial = AttributeMaterials.FindOrAdd( MaterialPath );
+    if ( !AttributeMaterial.IsValid() )
+    {
+        AttributeMaterial = Cast< UMaterialInterface >( StaticLoadObject(
+            UMaterialInterface::StaticClass(),
+            nullptr, *MaterialPath, nullptr, LOAD_NoWarn, nullptr ) );
+
+        if ( !AttributeMaterial.IsValid() )
+            MissingAttributeMaterials.Add( MaterialPath );
+    }
+
+    return AttributeMaterial.Get();
+}
+
 bool
 UHoudiniAssetComponent::ReplaceMaterial(
     const FHoudiniGeoPartObject & HoudiniGeoPartObject,
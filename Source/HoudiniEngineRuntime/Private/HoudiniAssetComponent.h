@@ -336,6 +336,9 @@ public:
         /** Add a material for the given shop name */
         void AddAssignmentMaterial( const FString& MaterialName, class UMaterialInterface* MaterialInterface ) override;
 
+        /** Load the material referenced by an unreal_material attribute, reusing the result of previous cooks. **/
+        class UMaterialInterface * LoadAttributeMaterial( const FString& MaterialPath ) override;
+
         /** Material Change **/
         virtual void SetMaterial(int32 ElementIndex, class UMaterialInterface* Material) override;
 
@@ -435,6 +438,10 @@ public:
         /** Delegate to handle asset actor movement */
         void OnActorMoved( AActor* Actor );
 
+        /** Delegates for asset registry additions and renames, missing attribute materials may now be loadable. **/
+        void OnAssetRegistryAssetAdded( const FAssetData & AssetData );
+        void OnAssetRegistryAssetRenamed( const FAssetData & AssetData, const FString & OldObjectPath );
+
         /** Subscribe to Editor events. **/
         void SubscribeEditorDelegates();
 
@@ -491,7 +498,13 @@ public:
             const TArray< const FHoudiniGeoPartObject* >& FoundLayers,
             const FHoudiniGeoPartObject& Heightfield,
             const int32& XSize, const int32& YSize,
-            TArray<FLandscapeImportLayerInfo>& ImportLayerInfos);
+            TArray<FLandscapeImportLayerInfo>& ImportLayerInfos,
+            ALandscape* ExistingLandscape = nullptr);
+
+        /** Assigns new materials to a landscape that is updated in place **/
+        void UpdateLandscapeMaterials(
+            ALandscape* Landscape,
+            UMaterialInterface* LandscapeMaterial, UMaterialInterface* LandscapeHoleMaterial);
 
         /** Create a Landscape actor from the data extracted from heightfield nodes **/
         ALandscape* CreateLandscape(
@@ -502,6 +515,18 @@ public:
             const int32& NumSectionPerLandscapeComponent, const int32& NumQuadsPerLandscapeSection,
             UMaterialInterface* LandscapeMaterial, UMaterialInterface* LandscapeHoleMaterial);
 
+        /** Create a tiled Landscape from the data extracted from heightfield nodes. The first tile is imported **/
+        /** in the returned Landscape actor, the other ones in landscape streaming proxies sharing its guid.      **/
+        /** The proxies are spawned in the persistent level. The height and layer data is released when done.   **/
+        ALandscape* CreateTiledLandscape(
+            TArray<uint16>& IntHeightData,
+            TArray<FLandscapeImportLayerInfo>& ImportLayerInfos,
+            const FTransform& LandscapeTransform,
+            const int32& XSize, const int32& YSize,
+            const int32& NumSectionPerLandscapeComponent, const int32& NumQuadsPerLandscapeSection,
+            const int32& TileSize,
+            UMaterialInterface* LandscapeMaterial, UMaterialInterface* LandscapeHoleMaterial);
+
         /** Creates a LandscapeLayerInfoObject in the TempCook folder **/
         ULandscapeLayerInfoObject * CreateLandscapeLayerInfoObject( const TCHAR* LayerName, UPackage*& Package );
 
@@ -665,6 +690,13 @@ public:
         /** As packages are unique their are used as the key (we can have multiple package for the same geopartobj  **/
         TMap< TWeakObjectPtr<class UPackage> , FHoudiniGeoPartObject > CookedTemporaryLandscapeLayers;
 
+        /** Transient cache of materials loaded from unreal_material attributes, indexed by material path.	    **/
+        /** Entries whose material asset has been deleted or replaced are invalid and reloaded on next use.	    **/
+        TMap< FString, TWeakObjectPtr< class UMaterialInterface > > AttributeMaterials;
+
+        /** Material paths from unreal_material attributes that failed to load, cleared when assets are added.	    **/
+        TSet< FString > MissingAttributeMaterials;
+
         /** Indicates that the details panels doesn't need a "full" update to avoid breaking parameter selection    **/
         /** (default behavior is true)										    **/
         bool bEditorPropertiesNeedFullUpdate;
@@ -680,6 +712,9 @@ public:
         /** Parameters for this component's asset, indexed by name for fast look up. **/
         TMap< FString, UHoudiniAssetParameter * > ParameterByName;
 
+        /** Layout of the parameters when they were last created, they are only rebuilt when it changes. **/
+        uint32 ParameterLayoutHash;
+
         /** Inputs for this component's asset. **/
         TArray< UHoudiniAssetInput * > Inputs;
 
@@ -745,6 +780,10 @@ public:
         /** Delegate to handle editor viewport drag and drop events. **/
         FDelegateHandle DelegateHandleApplyObjectToActor;
 
+        /** Delegate handles returned by asset registry added and renamed delegates. **/
+        FDelegateHandle DelegateHandleAssetRegistryAssetAdded;
+        FDelegateHandle DelegateHandleAssetRegistryAssetRenamed;
+
         /** Timer handle, this timer is used for cooking. **/
         FTimerHandle TimerHandleCooking;
 
@@ -194,9 +194,12 @@ UHoudiniAssetInput::UHoudiniAssetInput( const FObjectInitializer & ObjectInitial
     , InputAssetComponent( nullptr )
     , InputLandscapeProxy( nullptr )
     , ConnectedAssetId( -1 )
+    , InstancesPointsNodeId( -1 )
     , InputIndex( 0 )
     , ChoiceIndex( EHoudiniAssetInputType::GeometryInput )
+    , bWorldOutlinerInputsCheckScheduled( false )
     , UnrealSplineResolution( -1.0f )
+    , LandscapeInputExportFlags( 0u )
     , HoudiniAssetInputFlagsPacked( 0u )
 {
     // flags
@@ -361,19 +364,26 @@ UHoudiniAssetInput::DisconnectAndDestroyInputAsset()
                 if (FHoudiniEngineUtils::IsValidAssetId(InputOutlinerMeshArray[n].AssetId))
                 {
                     FHoudiniEngineUtils::HapiDisconnectAsset(ConnectedAssetId, InputOutlinerMeshArray[n].AssetId);
-                    FHoudiniEngineUtils::DestroyHoudiniAsset(InputOutlinerMeshArray[n].AssetId);
-                    InputOutlinerMeshArray[n].AssetId = -1;
+                    DestroyWorldOutlinerInputNode(InputOutlinerMeshArray[n]);
                 }
             }
         }
-        else if ( ChoiceIndex == EHoudiniAssetInputType::GeometryInput )
+
+        if ( ChoiceIndex == EHoudiniAssetInputType::GeometryInput
+            || ChoiceIndex == EHoudiniAssetInputType::LandscapeInput
+            || ChoiceIndex == EHoudiniAssetInputType::WorldInput )
         {
-            // Destroy all the geo input assets
+            // Destroy all the geo input assets, the landscape's heightfield volumes, or the removed world entries' nodes
             for ( HAPI_NodeId AssetNodeId : GeometryInputAssetIds )
             {
-                FHoudiniEngineUtils::DestroyHoudiniAsset( AssetNodeId );
+                if ( AssetNodeId >= 0 )
+                    FHoudiniEngineUtils::DestroyHoudiniAsset( AssetNodeId );
             }
             GeometryInputAssetIds.Empty();
+            GeometryInputMeshKeys.Empty();
+            InstancesPointsNodeId = -1;
+            LandscapeInputComponents.Empty();
+            LandscapeInputComponentHashes.Empty();
         }
 
         if (FHoudiniEngineUtils::IsValidAssetId(ConnectedAssetId))
@@ -384,6 +394,90 @@ UHoudiniAssetInput::DisconnectAndDestroyInputAsset()
     }
 }
 
+void
+UHoudiniAssetInput::DestroyWorldOutlinerInputNode( FHoudiniAssetInputOutlinerMesh & OutlinerMesh )
+{
+    if ( !FHoudiniEngineUtils::IsValidAssetId( OutlinerMesh.AssetId ) )
+        return;
+
+    // Keep the merge input slot, so only that input gets reconnected.
+    const int32 ConnectedIdx = GeometryInputAssetIds.Find( OutlinerMesh.AssetId );
+    if ( ConnectedIdx != INDEX_NONE )
+        GeometryInputAssetIds[ ConnectedIdx ] = -1;
+
+    FHoudiniEngineUtils::DestroyHoudiniAsset( OutlinerMesh.AssetId );
+    OutlinerMesh.AssetId = -1;
+    OutlinerMesh.MeshKey = 0;
+}
+
+bool
+UHoudiniAssetInput::UpdateWorldOutlinerInputNodes( HAPI_NodeId HostAssetId )
+{
+    if ( !bWorldInputExportAsInstances )
+    {
+        InstancesPointsNodeId = -1;
+        return FHoudiniEngineUtils::HapiUpdateInputNodeForData(
+            HostAssetId, InputOutlinerMeshArray,
+            ConnectedAssetId, GeometryInputAssetIds, UnrealSplineResolution );
+    }
+
+    // The previous entries' nodes are all in GeometryInputAssetIds, they are destroyed below.
+    for ( auto & OutlinerMesh : InputOutlinerMeshArray )
+    {
+        OutlinerMesh.AssetId = -1;
+        OutlinerMesh.MeshKey = 0;
+    }
+
+    // Create the new instances before destroying the previous ones, so the shared mesh inputs are kept.
+    HAPI_NodeId InstancesAssetId = -1;
+    HAPI_NodeId PointsNodeId = -1;
+    TArray< HAPI_NodeId > InstancesNodeIds;
+    const bool bSuccess = FHoudiniEngineUtils::HapiCreateInstancedInputNodeForData(
+        HostAssetId, InputOutlinerMeshArray,
+        InstancesAssetId, InstancesNodeIds, PointsNodeId, UnrealSplineResolution );
+
+    if ( !bSuccess )
+    {
+        // Don't leak the partially created instances, the caller resets the connected asset.
+        for ( HAPI_NodeId InstancesNodeId : InstancesNodeIds )
+        {
+            if ( InstancesNodeId >= 0 )
+                FHoudiniEngineUtils::DestroyHoudiniAsset( InstancesNodeId );
+        }
+
+        if ( FHoudiniEngineUtils::IsValidAssetId( InstancesAssetId ) )
+            FHoudiniEngineUtils::DestroyHoudiniAsset( InstancesAssetId );
+
+        for ( auto & OutlinerMesh : InputOutlinerMeshArray )
+            OutlinerMesh.AssetId = -1;
+
+        InstancesAssetId = -1;
+        PointsNodeId = -1;
+        InstancesNodeIds.Empty();
+    }
+
+    // The entries now reference the new nodes, so only destroy the previous merge node and its inputs.
+    if ( FHoudiniEngineUtils::IsValidAssetId( ConnectedAssetId ) )
+    {
+        if ( FHoudiniEngineUtils::IsValidAssetId( HostAssetId ) )
+            FHoudiniEngineUtils::HapiDisconnectAsset( HostAssetId, InputIndex );
+
+        FHoudiniEngineUtils::DestroyHoudiniAsset( ConnectedAssetId );
+    }
+
+    for ( HAPI_NodeId AssetNodeId : GeometryInputAssetIds )
+    {
+        if ( AssetNodeId >= 0 )
+            FHoudiniEngineUtils::DestroyHoudiniAsset( AssetNodeId );
+    }
+
+    ConnectedAssetId = InstancesAssetId;
+    GeometryInputAssetIds = InstancesNodeIds;
+    InstancesPointsNodeId = PointsNodeId;
+
+    return bSuccess;
+}
+
 bool
 UHoudiniAssetInput::CreateParameter(
     UObject * InPrimaryObject,
@@ -580,6 +674,27 @@ UHoudiniAssetInput::CreateWidget( IDetailCategoryBuilder & LocalDetailCategoryBu
             ];
         }
 
+	// Checkbox : Export as heightfield
+        {
+            TSharedPtr< SCheckBox > CheckBoxExportAsHeightfield;
+            VerticalBox->AddSlot().Padding( 2, 2, 5, 2 ).AutoHeight()
+            [
+                SAssignNew( CheckBoxExportAsHeightfield, SCheckBox )
+                .Content()
+                [
+                    SNew( STextBlock )
+                    .Text( LOCTEXT( "LandscapeExportAsHeightfieldCheckbox", "Export Landscape As Heightfield" ) )
+                    .ToolTipText( LOCTEXT( "LandscapeExportAsHeightfieldTooltip", "If enabled, the landscape height and layers will be exported as heightfield volumes instead of geometry." ) )
+                    .Font( FEditorStyle::GetFontStyle( TEXT( "PropertyWindow.NormalFont" ) ) )
+                ]
+                .IsChecked( TAttribute< ECheckBoxState >::Create(
+                    TAttribute< ECheckBoxState >::FGetter::CreateUObject(
+                        this, &UHoudiniAssetInput::IsCheckedExportAsHeightfield ) ) )
+                .OnCheckStateChanged( FOnCheckStateChanged::CreateUObject(
+                    this, &UHoudiniAssetInput::CheckStateChangedExportAsHeightfield ) )
+            ];
+        }
+
 	// Checkbox : Export materials
         {
             TSharedPtr< SCheckBox > CheckBoxExportMaterials;
@@ -745,6 +860,26 @@ UHoudiniAssetInput::CreateWidget( IDetailCategoryBuilder & LocalDetailCategoryBu
             ];
         }
 
+        // Checkbox : Export as instances
+        {
+            VerticalBox->AddSlot().Padding( 2, 2, 5, 2 ).AutoHeight()
+            [
+                SNew( SCheckBox )
+                .Content()
+                [
+                    SNew( STextBlock )
+                    .Text( LOCTEXT( "WorldInputExportAsInstancesCheckbox", "Export Meshes As Packed Instances" ) )
+                    .ToolTipText( LOCTEXT( "WorldInputExportAsInstancesTooltip", "If enabled, each unique mesh is exported once and the actors are exported as points, copied as packed primitives." ) )
+                    .Font( FEditorStyle::GetFontStyle( TEXT( "PropertyWindow.NormalFont" ) ) )
+                ]
+                .IsChecked( TAttribute< ECheckBoxState >::Create(
+                    TAttribute< ECheckBoxState >::FGetter::CreateUObject(
+                        this, &UHoudiniAssetInput::IsCheckedExportAsInstances ) ) )
+                .OnCheckStateChanged( FOnCheckStateChanged::CreateUObject(
+                    this, &UHoudiniAssetInput::CheckStateChangedExportAsInstances ) )
+            ];
+        }
+
         {
             // Spline Resolution
             TSharedPtr< SNumericEntryBox< float > > NumericEntryBox;
@@ -1075,11 +1210,14 @@ UHoudiniAssetInput::UploadParameterValue()
             {
                 if ( bStaticMeshChanged || bLoadedParameter )
                 {
-                    // Disconnect and destroy currently connected asset, if there's one.
-                    DisconnectAndDestroyInputAsset();
+                    // Disconnect and destroy currently connected asset after loading, otherwise its input nodes
+                    // are reused and only the meshes that changed are uploaded again.
+                    if ( bLoadedParameter )
+                        DisconnectAndDestroyInputAsset();
 
                     // Connect input and create connected asset. Will return by reference.
-                    if ( !FHoudiniEngineUtils::HapiCreateInputNodeForData( HostAssetId, InputObjects, ConnectedAssetId, GeometryInputAssetIds ) )
+                    if ( !FHoudiniEngineUtils::HapiCreateInputNodeForData(
+                        HostAssetId, InputObjects, ConnectedAssetId, GeometryInputAssetIds, GeometryInputMeshKeys ) )
                     {
                         bChanged = false;
                         ConnectedAssetId = -1;
@@ -1216,19 +1354,40 @@ UHoudiniAssetInput::UploadParameterValue()
             }
             else
             {
-                // Disconnect and destroy currently connected asset, if there's one.
-                DisconnectAndDestroyInputAsset();
-
                 // Connect input and create connected asset. Will return by reference.
-                if ( !FHoudiniEngineUtils::HapiCreateInputNodeForData(
-                        HostAssetId, InputLandscapeProxy,
-                        ConnectedAssetId, bLandscapeExportSelectionOnly, bLandscapeExportCurves,
-                        bLandscapeExportMaterials, bLandscapeExportAsMesh, bLandscapeExportLighting,
-                        bLandscapeExportNormalizedUVs, bLandscapeExportTileUVs ) )
+                if ( bLandscapeExportAsHeightfield )
                 {
-                    bChanged = false;
-                    ConnectedAssetId = -1;
-                    return false;
+                    // Disconnect and destroy currently connected asset, if there's one.
+                    DisconnectAndDestroyInputAsset();
+
+                    if ( !FHoudiniEngineUtils::HapiCreateHeightfieldInputNodeForData(
+                            HostAssetId, InputLandscapeProxy, ConnectedAssetId,
+                            GeometryInputAssetIds, bLandscapeExportSelectionOnly ) )
+                    {
+                        bChanged = false;
+                        ConnectedAssetId = -1;
+                        return false;
+                    }
+                }
+                else
+                {
+                    // Changing the export settings requires every component to be uploaded again,
+                    // otherwise only the components that changed since the last upload are sent.
+                    if ( LandscapeInputExportFlags != GetLandscapeExportFlags() )
+                        DisconnectAndDestroyInputAsset();
+
+                    LandscapeInputExportFlags = GetLandscapeExportFlags();
+
+                    if ( !FHoudiniEngineUtils::HapiUpdateInputNodeForLandscapeComponents(
+                            HostAssetId, InputLandscapeProxy, ConnectedAssetId,
+                            LandscapeInputComponents, GeometryInputAssetIds, LandscapeInputComponentHashes,
+                            bLandscapeExportSelectionOnly, bLandscapeExportMaterials, bLandscapeExportAsMesh,
+                            bLandscapeExportLighting, bLandscapeExportNormalizedUVs, bLandscapeExportTileUVs ) )
+                    {
+                        // The previous upload, if any, is left connected.
+                        bChanged = false;
+                        return false;
+                    }
                 }
 
                 // Connect the inputs and update the transform type
@@ -1249,13 +1408,12 @@ UHoudiniAssetInput::UploadParameterValue()
             {
                 if ( bStaticMeshChanged || bLoadedParameter )
                 {
-                    // Disconnect and destroy currently connected asset, if there's one.
-                    DisconnectAndDestroyInputAsset();
+                    // Disconnect and destroy currently connected asset, if it has been loaded.
+                    if ( bLoadedParameter )
+                        DisconnectAndDestroyInputAsset();
 
-                    // Connect input and create connected asset. Will return by reference.
-                    if ( !FHoudiniEngineUtils::HapiCreateInputNodeForData(
-                        HostAssetId, InputOutlinerMeshArray,
-                        ConnectedAssetId, UnrealSplineResolution ) )
+                    // Connect input and create or update connected asset. Only new or modified entries are uploaded.
+                    if ( !UpdateWorldOutlinerInputNodes( HostAssetId ) )
                     {
                         bChanged = false;
                         ConnectedAssetId = -1;
@@ -1285,6 +1443,24 @@ UHoudiniAssetInput::UploadParameterValue()
 }
 
 
+uint32
+UHoudiniAssetInput::GetLandscapeExportFlags() const
+{
+    uint32 ExportFlags = 0u;
+    ExportFlags |= bLandscapeExportMaterials ? ( 1u << 0 ) : 0u;
+    ExportFlags |= bLandscapeExportAsMesh ? ( 1u << 1 ) : 0u;
+    ExportFlags |= bLandscapeExportLighting ? ( 1u << 2 ) : 0u;
+    ExportFlags |= bLandscapeExportNormalizedUVs ? ( 1u << 3 ) : 0u;
+    ExportFlags |= bLandscapeExportTileUVs ? ( 1u << 4 ) : 0u;
+    ExportFlags |= bLandscapeExportAsHeightfield ? ( 1u << 5 ) : 0u;
+
+    // The export LOD changes the number of points of each component.
+    if ( InputLandscapeProxy )
+        ExportFlags |= ( (uint32) InputLandscapeProxy->ExportLOD ) << 8;
+
+    return ExportFlags;
+}
+
 uint32
 UHoudiniAssetInput::GetDefaultTranformTypeValue() const
 {
@@ -1840,9 +2016,7 @@ UHoudiniAssetInput::ChangeInputType(const EHoudiniAssetInputType::Enum& newType)
 
 	    // Force recook and reconnect of the input assets.
 	    HAPI_NodeId HostAssetId = GetAssetId();
-	    if (FHoudiniEngineUtils::HapiCreateInputNodeForData(
-		HostAssetId, InputOutlinerMeshArray,
-		ConnectedAssetId, UnrealSplineResolution))
+	    if (UpdateWorldOutlinerInputNodes(HostAssetId))
 	    {
 		ConnectInputNode();
 	    }
@@ -2008,7 +2182,10 @@ UHoudiniAssetInput::OnWorldOutlinerActorSelected( AActor * )
 void
 UHoudiniAssetInput::TickWorldOutlinerInputs()
 {
+    bWorldOutlinerInputsCheckScheduled = false;
+
     bool bLocalChanged = false;
+    bool bInstanceTransformsChanged = false;
     TArray< UStaticMeshComponent * > InputOutlinerMeshArrayPendingKill;
     for ( auto & OutlinerMesh : InputOutlinerMeshArray )
     {
@@ -2022,17 +2199,19 @@ UHoudiniAssetInput::TickWorldOutlinerInputs()
             }
 
             // Destroy Houdini asset.
-            if ( FHoudiniEngineUtils::IsValidAssetId( OutlinerMesh.AssetId ) )
-            {
-                FHoudiniEngineUtils::DestroyHoudiniAsset( OutlinerMesh.AssetId );
-                OutlinerMesh.AssetId = -1;
-            }
+            DestroyWorldOutlinerInputNode( OutlinerMesh );
 
             // Mark mesh for deletion.
             InputOutlinerMeshArrayPendingKill.Add( OutlinerMesh.StaticMeshComponent );
+
+            // The merge node needs to be rewired.
+            bStaticMeshChanged = true;
         }
-        else if ( OutlinerMesh.HasActorTransformChanged() && (OutlinerMesh.AssetId >= 0))
+        else if ( ( OutlinerMesh.HasActorTransformChanged()
+                || ( OutlinerMesh.StaticMeshComponent && OutlinerMesh.HasComponentTransformChanged() ) )
+            && ( OutlinerMesh.AssetId >= 0 ) && ( OutlinerMesh.KeepWorldTransform == bKeepWorldTransform ) )
         {
+            // The mesh itself didn't change, only its input node's transform needs to be updated.
             if (!bLocalChanged)
             {
                 Modify();
@@ -2056,9 +2235,27 @@ UHoudiniAssetInput::TickWorldOutlinerInputs()
                 FHoudiniEngine::Get().GetSession(),
                 LocalAssetNodeInfo.parentId, &HapiTransform);
         }
+        else if ( bWorldInputExportAsInstances && FHoudiniEngineUtils::IsValidAssetId( InstancesPointsNodeId )
+            && FHoudiniEngineUtils::IsInstancedInputMesh( OutlinerMesh )
+            && ( OutlinerMesh.HasActorTransformChanged() || OutlinerMesh.HasComponentTransformChanged() )
+            && ( OutlinerMesh.KeepWorldTransform == bKeepWorldTransform )
+            && OutlinerMesh.StaticMeshComponent && ( OutlinerMesh.StaticMeshComponent->GetStaticMesh() == OutlinerMesh.StaticMesh ) )
+        {
+            // Packed instance: only its point on the instance points node needs to be updated.
+            if ( !bLocalChanged )
+            {
+                Modify();
+                MarkPreChanged();
+                bLocalChanged = true;
+            }
+
+            UpdateWorldOutlinerTransforms( OutlinerMesh );
+            bInstanceTransformsChanged = true;
+        }
         else if ( OutlinerMesh.HasComponentTransformChanged() 
                 || OutlinerMesh.HasSplineComponentChanged(UnrealSplineResolution)
-                || (OutlinerMesh.KeepWorldTransform != bKeepWorldTransform) )
+                || (OutlinerMesh.KeepWorldTransform != bKeepWorldTransform)
+                || ( OutlinerMesh.StaticMeshComponent && OutlinerMesh.StaticMeshComponent->GetStaticMesh() != OutlinerMesh.StaticMesh ) )
         {
             if ( !bLocalChanged )
             {
@@ -2070,6 +2267,12 @@ UHoudiniAssetInput::TickWorldOutlinerInputs()
             // Update to the new Transforms
             UpdateWorldOutlinerTransforms(OutlinerMesh);
 
+            if ( OutlinerMesh.StaticMeshComponent )
+                OutlinerMesh.StaticMesh = OutlinerMesh.StaticMeshComponent->GetStaticMesh();
+
+            // Only this entry needs to be uploaded again.
+            DestroyWorldOutlinerInputNode( OutlinerMesh );
+
             // The component or spline has been modified so so we need to indicate that the "static mesh" 
             // has changed in order to rebuild the asset properly in UploadParameterValue()
             bStaticMeshChanged = true;
@@ -2089,6 +2292,14 @@ UHoudiniAssetInput::TickWorldOutlinerInputs()
             } );
         }
 
+        // Re-upload the instance points, unless all the instances are uploaded again anyway.
+        if ( bInstanceTransformsChanged && !bStaticMeshChanged )
+        {
+            TArray< UStaticMesh * > InstancedMeshes;
+            if ( !FHoudiniEngineUtils::HapiSetInstancedInputPoints( InstancesPointsNodeId, InputOutlinerMeshArray, InstancedMeshes ) )
+                bStaticMeshChanged = true;
+        }
+
         MarkChanged();
     }
 }
@@ -2262,16 +2473,12 @@ bool
 UHoudiniAssetInput::UpdateInputCurve()
 {
     bool Success = true;
-    FString CurvePointsString;
     EHoudiniSplineComponentType::Enum CurveTypeValue = EHoudiniSplineComponentType::Bezier;
     EHoudiniSplineComponentMethod::Enum CurveMethodValue = EHoudiniSplineComponentMethod::CVs;
     int32 CurveClosed = 1;
 
     if(ConnectedAssetId != -1)
     {
-        FHoudiniEngineUtils::HapiGetParameterDataAsString(
-            ConnectedAssetId, HAPI_UNREAL_PARAM_CURVE_COORDS, TEXT( "" ),
-            CurvePointsString );
         FHoudiniEngineUtils::HapiGetParameterDataAsInteger(
             ConnectedAssetId, HAPI_UNREAL_PARAM_CURVE_TYPE,
             (int32) EHoudiniSplineComponentType::Bezier, (int32 &) CurveTypeValue );
@@ -2298,10 +2505,6 @@ UHoudiniAssetInput::UpdateInputCurve()
         HoudiniGeoPartObject, HAPI_UNREAL_ATTRIB_POSITION,
         AttributeRefinedCurvePositions, RefinedCurvePositions );
 
-    // Process coords string and extract positions.
-    TArray< FVector > CurvePoints;
-    FHoudiniEngineUtils::ExtractStringPositions( CurvePointsString, CurvePoints );
-
     TArray< FVector > CurveDisplayPoints;
     FHoudiniEngineUtils::ConvertScaleAndFlipVectorData( RefinedCurvePositions, CurveDisplayPoints );
 
@@ -2547,6 +2750,71 @@ UHoudiniAssetInput::IsCheckedExportAsMesh() const
     return ECheckBoxState::Unchecked;
 }
 
+void
+UHoudiniAssetInput::CheckStateChangedExportAsHeightfield( ECheckBoxState NewState )
+{
+    int32 bState = ( NewState == ECheckBoxState::Checked );
+
+    if ( bLandscapeExportAsHeightfield != bState )
+    {
+        // Record undo information.
+        FScopedTransaction Transaction(
+            TEXT( HOUDINI_MODULE_RUNTIME ),
+            LOCTEXT( "HoudiniInputChange", "Houdini Export Landscape As Heightfield mode change." ),
+            PrimaryObject );
+        Modify();
+
+        MarkPreChanged();
+
+        bLandscapeExportAsHeightfield = bState;
+
+        // Mark this parameter as changed.
+        MarkChanged();
+    }
+}
+
+ECheckBoxState
+UHoudiniAssetInput::IsCheckedExportAsHeightfield() const
+{
+    if ( bLandscapeExportAsHeightfield )
+        return ECheckBoxState::Checked;
+
+    return ECheckBoxState::Unchecked;
+}
+
+void
+UHoudiniAssetInput::CheckStateChangedExportAsInstances( ECheckBoxState NewState )
+{
+    int32 bState = ( NewState == ECheckBoxState::Checked );
+
+    if ( bWorldInputExportAsInstances != bState )
+    {
+        // Record undo information.
+        FScopedTransaction Transaction(
+            TEXT( HOUDINI_MODULE_RUNTIME ),
+            LOCTEXT( "HoudiniInputChange", "Houdini Export Meshes As Packed Instances mode change." ),
+            PrimaryObject );
+        Modify();
+
+        MarkPreChanged();
+
+        bWorldInputExportAsInstances = bState;
+        bStaticMeshChanged = true;
+
+        // Mark this parameter as changed.
+        MarkChanged();
+    }
+}
+
+ECheckBoxState
+UHoudiniAssetInput::IsCheckedExportAsInstances() const
+{
+    if ( bWorldInputExportAsInstances )
+        return ECheckBoxState::Checked;
+
+    return ECheckBoxState::Unchecked;
+}
+
 void
 UHoudiniAssetInput::CheckStateChangedExportMaterials( ECheckBoxState NewState )
 {
@@ -2786,11 +3054,31 @@ UHoudiniAssetInput::OnButtonClickSelectActors()
     MarkPreChanged();
     bStaticMeshChanged = true;
 
-    // Delete all assets and reset the array.
-    // TODO: Make this process a little more efficient.
-    DisconnectAndDestroyInputAsset();
+    // Reset the array, entries that are still selected will keep their input node.
+    TArray< FHoudiniAssetInputOutlinerMesh > PreviousOutlinerMeshArray = MoveTemp( InputOutlinerMeshArray );
     InputOutlinerMeshArray.Empty();
 
+    auto AddOutlinerMesh = [ & ]( FHoudiniAssetInputOutlinerMesh & OutlinerMesh )
+    {
+        int32 PreviousIdx = PreviousOutlinerMeshArray.IndexOfByPredicate(
+            [ & ]( const FHoudiniAssetInputOutlinerMesh & PreviousOutlinerMesh )
+            {
+                return PreviousOutlinerMesh.Actor == OutlinerMesh.Actor
+                    && PreviousOutlinerMesh.StaticMeshComponent == OutlinerMesh.StaticMeshComponent
+                    && PreviousOutlinerMesh.SplineComponent == OutlinerMesh.SplineComponent;
+            } );
+
+        if ( PreviousIdx != INDEX_NONE )
+        {
+            InputOutlinerMeshArray.Add( PreviousOutlinerMeshArray[ PreviousIdx ] );
+            PreviousOutlinerMeshArray.RemoveAtSwap( PreviousIdx );
+        }
+        else
+        {
+            InputOutlinerMeshArray.Add( OutlinerMesh );
+        }
+    };
+
     USelection * SelectedActors = GEditor->GetSelectedActors();
 
     // If the builder brush is selected, first deselect it.
@@ -2826,7 +3114,7 @@ UHoudiniAssetInput::OnButtonClickSelectActors()
 
 	    UpdateWorldOutlinerTransforms(OutlinerMesh);
 
-	    InputOutlinerMeshArray.Add(OutlinerMesh);
+	    AddOutlinerMesh(OutlinerMesh);
         }
 
 	// Looking for Splines
@@ -2847,10 +3135,14 @@ UHoudiniAssetInput::OnButtonClickSelectActors()
 
 	    UpdateWorldOutlinerTransforms(OutlinerMesh);
 
-	    InputOutlinerMeshArray.Add(OutlinerMesh);
+	    AddOutlinerMesh(OutlinerMesh);
 	}
     }
 
+    // Destroy the input nodes of the actors that aren't selected anymore.
+    for ( auto & PreviousOutlinerMesh : PreviousOutlinerMeshArray )
+        DestroyWorldOutlinerInputNode( PreviousOutlinerMesh );
+
     MarkChanged();
 
     AActor* HoudiniAssetActor = GetHoudiniAssetComponent()->GetOwner();
@@ -2888,12 +3180,16 @@ UHoudiniAssetInput::OnButtonClickSelectActors()
 void
 UHoudiniAssetInput::StartWorldOutlinerTicking()
 {
+    // Changes to the input Actors are detected through editor events, the selection might have changed.
+    SubscribeWorldOutlinerDelegates();
+
     if ( InputOutlinerMeshArray.Num() > 0 && !WorldOutlinerTimerDelegate.IsBound() && GEditor )
     {
         WorldOutlinerTimerDelegate = FTimerDelegate::CreateUObject( this, &UHoudiniAssetInput::TickWorldOutlinerInputs );
 
         // We need to register delegate with the timer system.
-        static const float TickTimerDelay = 0.5f;
+        // The timer is only a fallback for the changes that aren't broadcast.
+        static const float TickTimerDelay = 2.0f;
         GEditor->GetTimerManager()->SetTimer( WorldOutlinerTimerHandle, WorldOutlinerTimerDelegate, TickTimerDelay, true );
     }
 }
@@ -2905,9 +3201,149 @@ UHoudiniAssetInput::StopWorldOutlinerTicking()
     {
         GEditor->GetTimerManager()->ClearTimer( WorldOutlinerTimerHandle );
         WorldOutlinerTimerDelegate.Unbind();
+
+        UnsubscribeWorldOutlinerDelegates();
     }
 }
 
+void
+UHoudiniAssetInput::SubscribeWorldOutlinerDelegates()
+{
+    UnsubscribeWorldOutlinerDelegates();
+
+    if ( InputOutlinerMeshArray.Num() <= 0 )
+        return;
+
+    if ( GEditor )
+        GEditor->OnActorMoved().AddUObject( this, &UHoudiniAssetInput::OnWorldOutlinerActorChanged );
+
+    if ( GEngine )
+        GEngine->OnLevelActorDeleted().AddUObject( this, &UHoudiniAssetInput::OnWorldOutlinerActorChanged );
+
+    DelegateHandleWorldOutlinerPropertyChanged =
+        FCoreUObjectDelegates::OnObjectPropertyChanged.AddUObject( this, &UHoudiniAssetInput::OnWorldOutlinerObjectPropertyChanged );
+
+    for ( auto & OutlinerMesh : InputOutlinerMeshArray )
+    {
+        USceneComponent * Component = OutlinerMesh.StaticMeshComponent;
+        if ( !Component )
+            Component = OutlinerMesh.SplineComponent;
+
+        if ( !Component )
+            continue;
+
+        Component->TransformUpdated.AddUObject( this, &UHoudiniAssetInput::OnWorldOutlinerComponentTransformUpdated );
+        WorldOutlinerSubscribedComponents.Add( Component );
+    }
+}
+
+void
+UHoudiniAssetInput::UnsubscribeWorldOutlinerDelegates()
+{
+    if ( GEditor )
+        GEditor->OnActorMoved().RemoveAll( this );
+
+    if ( GEngine )
+        GEngine->OnLevelActorDeleted().RemoveAll( this );
+
+    FCoreUObjectDelegates::OnObjectPropertyChanged.Remove( DelegateHandleWorldOutlinerPropertyChanged );
+    DelegateHandleWorldOutlinerPropertyChanged.Reset();
+
+    for ( auto & SubscribedComponent : WorldOutlinerSubscribedComponents )
+    {
+        if ( USceneComponent * Component = SubscribedComponent.Get() )
+            Component->TransformUpdated.RemoveAll( this );
+    }
+
+    WorldOutlinerSubscribedComponents.Empty();
+}
+
+void
+UHoudiniAssetInput::OnWorldOutlinerActorChanged( AActor * Actor )
+{
+    if ( IsWorldOutlinerInputObject( Actor ) )
+        ScheduleWorldOutlinerInputsCheck();
+}
+
+void
+UHoudiniAssetInput::OnWorldOutlinerObjectPropertyChanged( UObject * Object, FPropertyChangedEvent & PropertyChangedEvent )
+{
+    if ( !Object )
+        return;
+
+    // A modified input mesh needs to be uploaded again. Its keys are invalidated, as not every modification
+    // changes them, and so is its shared input node, which packed instances copy instead of having their own node.
+    if ( UStaticMesh * StaticMesh = Cast< UStaticMesh >( Object ) )
+    {
+        if ( !FHoudiniEngineUtils::IsValidAssetId( ConnectedAssetId ) )
+            return;
+
+        bool bMeshUsed = false;
+        for ( auto & OutlinerMesh : InputOutlinerMeshArray )
+        {
+            if ( OutlinerMesh.StaticMesh != StaticMesh )
+                continue;
+
+            if ( OutlinerMesh.AssetId >= 0
+                || ( bWorldInputExportAsInstances && FHoudiniEngineUtils::IsInstancedInputMesh( OutlinerMesh ) ) )
+            {
+                OutlinerMesh.MeshKey = 0;
+                bMeshUsed = true;
+            }
+        }
+
+        if ( bMeshUsed )
+        {
+            FHoudiniEngineUtils::InvalidateSharedInputNodeForData( StaticMesh );
+
+            MarkPreChanged();
+            bStaticMeshChanged = true;
+            MarkChanged();
+        }
+
+        return;
+    }
+
+    if ( IsWorldOutlinerInputObject( Object ) )
+        ScheduleWorldOutlinerInputsCheck();
+}
+
+void
+UHoudiniAssetInput::OnWorldOutlinerComponentTransformUpdated(
+    USceneComponent * Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport )
+{
+    ScheduleWorldOutlinerInputsCheck();
+}
+
+bool
+UHoudiniAssetInput::IsWorldOutlinerInputObject( const UObject * Object ) const
+{
+    if ( !Object )
+        return false;
+
+    for ( const auto & OutlinerMesh : InputOutlinerMeshArray )
+    {
+        if ( Object == OutlinerMesh.Actor
+            || Object == OutlinerMesh.StaticMeshComponent
+            || Object == OutlinerMesh.SplineComponent )
+            return true;
+    }
+
+    return false;
+}
+
+void
+UHoudiniAssetInput::ScheduleWorldOutlinerInputsCheck()
+{
+    // Several events can be broadcast for the same change, they are handled once on next tick.
+    if ( bWorldOutlinerInputsCheckScheduled || !GEditor )
+        return;
+
+    bWorldOutlinerInputsCheckScheduled = true;
+    GEditor->GetTimerManager()->SetTimerForNextTick(
+        FTimerDelegate::CreateUObject( this, &UHoudiniAssetInput::TickWorldOutlinerInputs ) );
+}
+
 void UHoudiniAssetInput::InvalidateNodeIds()
 {
     ConnectedAssetId = -1;
@@ -43,6 +43,7 @@
 #include "HoudiniAssetInput.generated.h"
 
 class ALandscapeProxy;
+class ULandscapeComponent;
 class UHoudiniSplineComponent;
 class USplineComponent;
 
@@ -107,6 +108,9 @@ struct HOUDINIENGINERUNTIME_API FHoudiniAssetInputOutlinerMesh
 
     /** Mesh's input asset id. **/
     HAPI_NodeId AssetId = -1;
+
+    /** Key of the mesh uploaded to AssetId, used to detect modification of the mesh. Not serialized. **/
+    uint32 MeshKey = 0;
     
     /** TranformType used to generate the asset **/
     int32 KeepWorldTransform = 2;
@@ -297,6 +301,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Extract curve parameters and update the attached spline component. **/
         bool UpdateInputCurve();
 
+        /** Destroy the input node of a world outliner entry, it will be uploaded again on next update. **/
+        void DestroyWorldOutlinerInputNode( FHoudiniAssetInputOutlinerMesh & OutlinerMesh );
+
+        /** Create or update the connected asset of the world outliner input, as separate inputs or as instances. **/
+        bool UpdateWorldOutlinerInputNodes( HAPI_NodeId HostAssetId );
+
         /** Clear input curve parameters. **/
         void ClearInputCurveParameters();
 
@@ -318,6 +328,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Returns the default value for this input Transform Type, 0 = none / 1 = IntoThisObject **/
         uint32 GetDefaultTranformTypeValue() const;
 
+        /** Returns the landscape export settings that affect the uploaded geometry. **/
+        uint32 GetLandscapeExportFlags() const;
+
         /** Returns the input object at index or nullptr */
         UObject* GetInputObject( int32 AtIndex ) const;
 
@@ -362,6 +375,18 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Return checked state of landscape full geometry checkbox. **/
         ECheckBoxState IsCheckedExportAsMesh() const;
 
+        /** Check if state of landscape heightfield checkbox has changed. **/
+        void CheckStateChangedExportAsHeightfield( ECheckBoxState NewState );
+
+        /** Return checked state of landscape heightfield checkbox. **/
+        ECheckBoxState IsCheckedExportAsHeightfield() const;
+
+        /** Check if state of world outliner instances checkbox has changed. **/
+        void CheckStateChangedExportAsInstances( ECheckBoxState NewState );
+
+        /** Return checked state of world outliner instances checkbox. **/
+        ECheckBoxState IsCheckedExportAsInstances() const;
+
         /** Check if state of landscape materials checkbox has changed. **/
         void CheckStateChangedExportMaterials( ECheckBoxState NewState );
 
@@ -404,6 +429,28 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Stop world outliner Actor transform monitor ticking. **/
         void StopWorldOutlinerTicking();
 
+        /** Subscribe to the change events of the world outliner input Actors and their components. **/
+        void SubscribeWorldOutlinerDelegates();
+
+        /** Unsubscribe from the change events of the world outliner input Actors. **/
+        void UnsubscribeWorldOutlinerDelegates();
+
+        /** Called when an Actor has been moved or deleted in the editor. **/
+        void OnWorldOutlinerActorChanged( AActor * Actor );
+
+        /** Called when a property of an object has been changed in the editor. **/
+        void OnWorldOutlinerObjectPropertyChanged( UObject * Object, FPropertyChangedEvent & PropertyChangedEvent );
+
+        /** Called when the transform of a world outliner input component has been updated. **/
+        void OnWorldOutlinerComponentTransformUpdated(
+            USceneComponent * Component, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport );
+
+        /** Return true if the object is one of the world outliner input Actors or components. **/
+        bool IsWorldOutlinerInputObject( const UObject * Object ) const;
+
+        /** Check the world outliner inputs for changes on next editor tick. **/
+        void ScheduleWorldOutlinerInputsCheck();
+
         /** Set value of the SplineResolution for world outliners, used by Slate. **/
         void SetSplineResolutionValue(float InValue);
 
@@ -439,9 +486,24 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Id of currently connected asset. **/
         HAPI_NodeId ConnectedAssetId;
 
-        /** The ids of the assets connected to the input for GeometryInput mode */
+        /** The ids of the assets connected to the input for GeometryInput and WorldInput modes, or the heightfield volumes in LandscapeInput mode */
         TArray< HAPI_NodeId > GeometryInputAssetIds;
 
+        /** Input node of the instance points when the world outliner input is exported as packed instances. **/
+        HAPI_NodeId InstancesPointsNodeId;
+
+        /** Keys of the meshes uploaded to GeometryInputAssetIds in GeometryInput mode, to skip unchanged meshes. **/
+        TArray< uint32 > GeometryInputMeshKeys;
+
+        /** The landscape components uploaded in LandscapeInput mode, matching the input nodes in GeometryInputAssetIds. **/
+        TArray< TWeakObjectPtr< ULandscapeComponent > > LandscapeInputComponents;
+
+        /** Content hashes of the uploaded landscape components, used to only re-upload the ones that changed. **/
+        TArray< uint32 > LandscapeInputComponentHashes;
+
+        /** Landscape export settings used for the last upload, changing them requires re-uploading every component. **/
+        uint32 LandscapeInputExportFlags;
+
         /** Index of this input. **/
         int32 InputIndex;
 
@@ -454,6 +516,15 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
         /** Timer delegate, we use it for ticking to see if input Actors have changed. **/
         FTimerDelegate WorldOutlinerTimerDelegate;
 
+        /** Delegate handle for property changes of the world outliner input objects. **/
+        FDelegateHandle DelegateHandleWorldOutlinerPropertyChanged;
+
+        /** Components of the world outliner inputs whose transform updates we are subscribed to. **/
+        TArray< TWeakObjectPtr< USceneComponent > > WorldOutlinerSubscribedComponents;
+
+        /** Is set to true when a check of the world outliner inputs is scheduled for next tick. **/
+        bool bWorldOutlinerInputsCheckScheduled;
+
         float UnrealSplineResolution;
 
         /** Flags used by this input. **/
@@ -499,6 +570,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInput : public UHoudiniAssetParamete
 
                 /** Is set to true when this input's Transform Type is set to NONE, 2 will use the input's default value **/
                 uint32 bKeepWorldTransform : 2;
+
+                /** Is set to true when the landscape is to be exported as heightfield volumes. **/
+                uint32 bLandscapeExportAsHeightfield : 1;
+
+                /** Is set to true when the world outliner meshes are to be exported as packed instances. **/
+                uint32 bWorldInputExportAsInstances : 1;
             };
 
             uint32 HoudiniAssetInputFlagsPacked;
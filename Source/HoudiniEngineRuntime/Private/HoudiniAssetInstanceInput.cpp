@@ -37,6 +37,7 @@
 #include "HoudiniAssetInstanceInputField.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniRuntimeSettings.h"
 #include "HoudiniInstancedActorComponent.h"
 #include "Components/AudioComponent.h"
 #include "Particles/ParticleSystemComponent.h"
@@ -52,6 +53,8 @@
 UHoudiniAssetInstanceInput::UHoudiniAssetInstanceInput( const FObjectInitializer& ObjectInitializer )
     : Super( ObjectInitializer )
     , ObjectToInstanceId( -1 )
+    , InstanceStartCullDistance( 0 )
+    , InstanceEndCullDistance( 0 )
     , HoudiniAssetInstanceInputFlagsPacked( 0u )
 {
     TupleSize = 0;
@@ -146,6 +149,9 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
 
     HAPI_NodeId AssetId = GetAssetId();
 
+    // Output settings need to be known before fields create their components.
+    UpdateInstancerOutputSettings();
+
     // Retrieve instance transforms (for each point).
     TArray< FTransform > AllTransforms;
     HoudiniGeoPartObject.HapiGetInstanceTransforms( AssetId, AllTransforms );
@@ -169,12 +175,11 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
 
         //HOUDINI_LOG_MESSAGE( TEXT( "Part Instancer (%s): IPC=%d, IC=%d" ), *PartName, PartInfo.instancedPartCount, PartInfo.instanceCount );
 
-        // Get transforms for each instance
-        TArray<HAPI_Transform> InstancerPartTransforms;
-        InstancerPartTransforms.SetNumZeroed( PartInfo.instanceCount );
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetInstancerPartTransforms(
-            FHoudiniEngine::Get().GetSession(), HoudiniGeoPartObject.GeoId, PartInfo.id,
-            HAPI_RSTORDER_DEFAULT, InstancerPartTransforms.GetData(), 0, PartInfo.instanceCount ), false );
+        // Get transforms for each instance, they are shared by all instanced parts.
+        TArray< FTransform > ObjectTransforms;
+        if ( !FHoudiniEngineUtils::HapiFetchInstanceTransforms(
+            HoudiniGeoPartObject.GeoId, PartInfo.id, PartInfo.instanceCount, ObjectTransforms ) )
+            return false;
 
         // Get the part ids for parts being instanced
         TArray<HAPI_PartId> InstancedPartIds;
@@ -191,15 +196,6 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
                     FHoudiniEngine::Get().GetSession(), HoudiniGeoPartObject.GeoId, InstancedPartId,
                     &InstancedPartInfo ), false );
 
-            TArray<FTransform> ObjectTransforms;
-            ObjectTransforms.SetNumUninitialized( InstancerPartTransforms.Num() );
-            for ( int32 InstanceIdx = 0; InstanceIdx < InstancerPartTransforms.Num(); ++InstanceIdx )
-            {
-                const auto& InstanceTransform = InstancerPartTransforms[InstanceIdx];
-                FHoudiniEngineUtils::TranslateHapiTransform( InstanceTransform, ObjectTransforms[InstanceIdx] );
-                //HOUDINI_LOG_MESSAGE( TEXT( "Instance %d:%d Transform: %s for Part Id %d" ), HoudiniGeoPartObject.PartId, InstanceIdx, *ObjectTransforms[ InstanceIdx ].ToString(), InstancedPartId );
-            }
-
             // Create this instanced input field for this instanced part
             //
             FHoudiniGeoPartObject InstancedPart( HoudiniGeoPartObject.AssetId, HoudiniGeoPartObject.ObjectId, HoudiniGeoPartObject.GeoId, InstancedPartId );
@@ -301,7 +297,7 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
             if ( AttributeObject )
             {
                 CreateInstanceInputField(
-                    AttributeObject, AllTransforms, InstanceInputFields,
+                    AttributeObject, MoveTemp( AllTransforms ), InstanceInputFields,
                     NewInstanceInputFields );
             }
             else
@@ -311,51 +307,80 @@ UHoudiniAssetInstanceInput::CreateInstanceInput()
         }
         else if ( ResultAttributeInfo.owner == HAPI_ATTROWNER_POINT )
         {
-            TArray< FString > PointInstanceValues;
+            TArray< HAPI_StringHandle > PointInstanceHandles;
 
-            if ( !HoudiniGeoPartObject.HapiGetAttributeDataAsString(
-                AssetId, MarshallingAttributeInstanceOverride,
-                HAPI_ATTROWNER_POINT, ResultAttributeInfo, PointInstanceValues ) )
+            if ( !HoudiniGeoPartObject.HapiGetAttributeDataAsStringHandles(
+                AssetId, MarshallingAttributeInstanceOverride.c_str(),
+                HAPI_ATTROWNER_POINT, ResultAttributeInfo, PointInstanceHandles ) )
             {
                 // This should not happen - attribute exists, but there was an error retrieving it.
                 return false;
             }
 
             // Attribute is on points, number of points must match number of transforms.
-            if ( !ensure(PointInstanceValues.Num() == AllTransforms.Num()) )
+            if ( !ensure( PointInstanceHandles.Num() == AllTransforms.Num() ) )
             {
                 // This should not happen, we have mismatch between number of instance values and transforms.
                 return false;
             }
 
-            // If instance attribute exists on points, we need to get all unique values.
-            TMap< FString, UObject * > ObjectsToInstance;
+            // Bucket points by instance path in a single pass. Each distinct string handle is
+            // resolved only once, handles which resolve to the same path share their bucket.
+            TMap< HAPI_StringHandle, int32 > HandleBuckets;
+            TMap< FString, int32 > PathBuckets;
+            TArray< FString > BucketPaths;
+            TArray< int32 > BucketCounts;
+            TArray< int32 > PointBuckets;
+            PointBuckets.SetNumUninitialized( PointInstanceHandles.Num() );
 
-            for ( auto Iter : PointInstanceValues )
+            for ( int32 PointIdx = 0; PointIdx < PointInstanceHandles.Num(); ++PointIdx )
             {
-                const FString & UniqueName = *Iter;
-
-                if ( !ObjectsToInstance.Contains( UniqueName ) )
+                const HAPI_StringHandle PointInstanceHandle = PointInstanceHandles[ PointIdx ];
+                int32 * FoundBucket = HandleBuckets.Find( PointInstanceHandle );
+                if ( !FoundBucket )
                 {
-                    UObject * AttributeObject = StaticLoadObject( 
-                        UObject::StaticClass(), nullptr, *UniqueName, nullptr, LOAD_None, nullptr );
+                    FString InstancePath;
+                    FHoudiniEngineString( PointInstanceHandle ).ToFString( InstancePath );
 
-                    ObjectsToInstance.Add( UniqueName, AttributeObject );
+                    int32 BucketIdx = BucketPaths.Num();
+                    if ( int32 * FoundPathBucket = PathBuckets.Find( InstancePath ) )
+                    {
+                        BucketIdx = *FoundPathBucket;
+                    }
+                    else
+                    {
+                        PathBuckets.Add( InstancePath, BucketIdx );
+                        BucketPaths.Add( InstancePath );
+                        BucketCounts.Add( 0 );
+                    }
+
+                    FoundBucket = &HandleBuckets.Add( PointInstanceHandle, BucketIdx );
                 }
+
+                PointBuckets[ PointIdx ] = *FoundBucket;
+                BucketCounts[ *FoundBucket ]++;
             }
 
+            TArray< TArray< FTransform > > BucketTransforms;
+            BucketTransforms.SetNum( BucketPaths.Num() );
+            for ( int32 BucketIdx = 0; BucketIdx < BucketPaths.Num(); ++BucketIdx )
+                BucketTransforms[ BucketIdx ].Reserve( BucketCounts[ BucketIdx ] );
+
+            for ( int32 PointIdx = 0; PointIdx < PointBuckets.Num(); ++PointIdx )
+                BucketTransforms[ PointBuckets[ PointIdx ] ].Add( AllTransforms[ PointIdx ] );
+
             bool Success = false;
 
-            for( auto Iter : ObjectsToInstance )
+            for ( int32 BucketIdx = 0; BucketIdx < BucketPaths.Num(); ++BucketIdx )
             {
-                const FString & InstancePath = Iter.Key;
-                UObject * AttributeObject = Iter.Value;
+                UObject * AttributeObject = StaticLoadObject(
+                    UObject::StaticClass(), nullptr, *BucketPaths[ BucketIdx ], nullptr, LOAD_None, nullptr );
 
                 if ( AttributeObject )
                 {
-                    TArray< FTransform > ObjectTransforms;
-                    GetPathInstaceTransforms( InstancePath, PointInstanceValues, AllTransforms, ObjectTransforms );
-                    CreateInstanceInputField( AttributeObject, ObjectTransforms, InstanceInputFields, NewInstanceInputFields );
+                    CreateInstanceInputField(
+                        AttributeObject, MoveTemp( BucketTransforms[ BucketIdx ] ),
+                        InstanceInputFields, NewInstanceInputFields );
                     Success = true;
                 }
             }
@@ -428,7 +453,10 @@ UHoudiniAssetInstanceInput::CleanInstanceInputFields( TArray< UHoudiniAssetInsta
     {
         UHoudiniAssetInstanceInputField * HoudiniAssetInstanceInputField = InstanceInputFields[ FieldIdx ];
         if ( HoudiniAssetInstanceInputField)
+        {
+            HoudiniAssetInstanceInputField->ClearFoliageInstances();
             HoudiniAssetInstanceInputField->ConditionalBeginDestroy();
+        }
     }
 
     InInstanceInputFields.Empty();
@@ -457,7 +485,7 @@ UHoudiniAssetInstanceInput::GetAssetId() const
 void
 UHoudiniAssetInstanceInput::CreateInstanceInputField(
     const FHoudiniGeoPartObject & InHoudiniGeoPartObject,
-    const TArray< FTransform > & ObjectTransforms,
+    TArray< FTransform > ObjectTransforms,
     const TArray< UHoudiniAssetInstanceInputField * > & OldInstanceInputFields,
     TArray<UHoudiniAssetInstanceInputField * > & NewInstanceInputFields)
 {
@@ -505,7 +533,7 @@ UHoudiniAssetInstanceInput::CreateInstanceInputField(
         }
 
         // Set transforms for this input.
-        HoudiniAssetInstanceInputField->SetInstanceTransforms( ObjectTransforms );
+        HoudiniAssetInstanceInputField->SetInstanceTransforms( MoveTemp( ObjectTransforms ) );
 
         // Add field to list of fields.
         NewInstanceInputFields.Add( HoudiniAssetInstanceInputField );
@@ -520,12 +548,10 @@ UHoudiniAssetInstanceInput::CreateInstanceInputField(
             FHoudiniEngine::Get().GetSession(), InHoudiniGeoPartObject.GeoId, InHoudiniGeoPartObject.PartId,
             &PartInfo ) );
 
-        // Get transforms for each instance
-        TArray<HAPI_Transform> InstancerPartTransforms;
-        InstancerPartTransforms.SetNumZeroed( PartInfo.instanceCount );
-        HOUDINI_CHECK_ERROR( &Result, FHoudiniApi::GetInstancerPartTransforms(
-            FHoudiniEngine::Get().GetSession(), InHoudiniGeoPartObject.GeoId, PartInfo.id,
-            HAPI_RSTORDER_DEFAULT, InstancerPartTransforms.GetData(), 0, PartInfo.instanceCount ) );
+        // Get transforms for each instance, they are shared by all instanced parts.
+        TArray< FTransform > PPObjectTransforms;
+        FHoudiniEngineUtils::HapiFetchInstanceTransforms(
+            InHoudiniGeoPartObject.GeoId, PartInfo.id, PartInfo.instanceCount, PPObjectTransforms );
 
         // Get the part ids for parts being instanced
         TArray<HAPI_PartId> InstancedPartIds;
@@ -542,14 +568,6 @@ UHoudiniAssetInstanceInput::CreateInstanceInputField(
                     FHoudiniEngine::Get().GetSession(), InHoudiniGeoPartObject.GeoId, InstancedPartId,
                     &InstancedPartInfo ) );
 
-            TArray<FTransform> PPObjectTransforms;
-            PPObjectTransforms.SetNumUninitialized( InstancerPartTransforms.Num() );
-            for ( int32 InstanceIdx = 0; InstanceIdx < InstancerPartTransforms.Num(); ++InstanceIdx )
-            {
-                const auto& InstanceTransform = InstancerPartTransforms[InstanceIdx];
-                FHoudiniEngineUtils::TranslateHapiTransform( InstanceTransform, PPObjectTransforms[InstanceIdx] );
-            }
-
             // Create this instanced input field for this instanced part
             
             // find static mesh for this instancer
@@ -567,7 +585,7 @@ UHoudiniAssetInstanceInput::CreateInstanceInputField(
                     }
                 }
 
-                CreateInstanceInputField( FoundStaticMesh, AllTransforms, InstanceInputFields, NewInstanceInputFields );
+                CreateInstanceInputField( FoundStaticMesh, MoveTemp( AllTransforms ), InstanceInputFields, NewInstanceInputFields );
             }
             else
             {
@@ -586,7 +604,7 @@ UHoudiniAssetInstanceInput::CreateInstanceInputField(
 void
 UHoudiniAssetInstanceInput::CreateInstanceInputField(
     UObject * InstancedObject,
-    const TArray< FTransform > & ObjectTransforms,
+    TArray< FTransform > ObjectTransforms,
     const TArray< UHoudiniAssetInstanceInputField * > & OldInstanceInputFields,
     TArray< UHoudiniAssetInstanceInputField * > & NewInstanceInputFields )
 {
@@ -638,7 +656,7 @@ UHoudiniAssetInstanceInput::CreateInstanceInputField(
     }
 
     // Set transforms for this input.
-    HoudiniAssetInstanceInputField->SetInstanceTransforms( ObjectTransforms );
+    HoudiniAssetInstanceInputField->SetInstanceTransforms( MoveTemp( ObjectTransforms ) );
 
     // Add field to list of fields.
     NewInstanceInputFields.Add( HoudiniAssetInstanceInputField );
@@ -1041,6 +1059,16 @@ UHoudiniAssetInstanceInput::BeginDestroy()
     Super::BeginDestroy();
 }
 
+void
+UHoudiniAssetInstanceInput::ClearFoliageInstances()
+{
+    for ( UHoudiniAssetInstanceInputField * HoudiniAssetInstanceInputField : InstanceInputFields )
+    {
+        if ( HoudiniAssetInstanceInputField )
+            HoudiniAssetInstanceInputField->ClearFoliageInstances();
+    }
+}
+
 void
 UHoudiniAssetInstanceInput::SetHoudiniAssetComponent( UHoudiniAssetComponent * InComponent )
 {
@@ -1240,7 +1268,7 @@ UHoudiniAssetInstanceInput::CloneComponentsAndAttachToActor( AActor * Actor )
             }
 
             UInstancedStaticMeshComponent* DuplicatedComponent = NewObject< UInstancedStaticMeshComponent >(
-                    Actor, UInstancedStaticMeshComponent::StaticClass(), NAME_None, RF_Public );
+                    Actor, InstancedStaticMeshComponent->GetClass(), NAME_None, RF_Public );
 
             Actor->AddInstanceComponent( DuplicatedComponent );
             DuplicatedComponent->SetStaticMesh( OutStaticMesh );
@@ -1257,8 +1285,10 @@ UHoudiniAssetInstanceInput::CloneComponentsAndAttachToActor( AActor * Actor )
                     DuplicatedComponent, InstancedTransforms, RotationOffset, ScaleOffset );
             }
 
-            // Copy visibility.
+            // Copy visibility and cull distances.
             DuplicatedComponent->SetVisibility( InstancedStaticMeshComponent->IsVisible() );
+            DuplicatedComponent->InstanceStartCullDistance = InstancedStaticMeshComponent->InstanceStartCullDistance;
+            DuplicatedComponent->InstanceEndCullDistance = InstancedStaticMeshComponent->InstanceEndCullDistance;
 
             DuplicatedComponent->AttachToComponent( RootComponent, FAttachmentTransformRules::KeepRelativeTransform );
             DuplicatedComponent->RegisterComponent();
@@ -1272,17 +1302,58 @@ UHoudiniAssetInstanceInput::CloneComponentsAndAttachToActor( AActor * Actor )
 #endif
 
 void
-UHoudiniAssetInstanceInput::GetPathInstaceTransforms(
-    const FString & ObjectInstancePath,
-    const TArray< FString > & PointInstanceValues, const TArray< FTransform > & Transforms,
-    TArray< FTransform > & OutTransforms)
+UHoudiniAssetInstanceInput::UpdateInstancerOutputSettings()
 {
-    OutTransforms.Empty();
+    HAPI_NodeId AssetId = GetAssetId();
+
+    // Hierarchical instancing is enabled globally, or per instancer through an attribute.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    bool bHierarchical = HoudiniRuntimeSettings && HoudiniRuntimeSettings->bUseHierarchicalInstancers;
+
+    HAPI_AttributeInfo AttributeInfo;
+    FMemory::Memset< HAPI_AttributeInfo >( AttributeInfo, 0 );
 
-    for ( int32 Idx = 0; Idx < PointInstanceValues.Num(); ++Idx )
+    TArray< int32 > HierarchicalValues;
+    if ( HoudiniGeoPartObject.HapiGetAttributeDataAsInt(
+        AssetId, HAPI_UNREAL_ATTRIB_HIERARCHICAL_INSTANCER, AttributeInfo, HierarchicalValues ) &&
+        HierarchicalValues.Num() > 0 )
     {
-        if ( ObjectInstancePath.Equals( PointInstanceValues[ Idx ] ) )
-            OutTransforms.Add( Transforms[ Idx ] );
+        bHierarchical = HierarchicalValues[ 0 ] != 0;
+    }
+
+    bUseHierarchicalInstancer = bHierarchical;
+
+    // Instances can be sent to the level's foliage instead of component-owned instancers.
+    TArray< int32 > FoliageValues;
+    bOutputToFoliage = HoudiniGeoPartObject.HapiGetAttributeDataAsInt(
+        AssetId, HAPI_UNREAL_ATTRIB_FOLIAGE_INSTANCER, AttributeInfo, FoliageValues ) &&
+        FoliageValues.Num() > 0 && FoliageValues[ 0 ] != 0;
+
+    // Cull distances are per component, so point values are reduced to the widest range.
+    InstanceStartCullDistance = 0;
+    InstanceEndCullDistance = 0;
+
+    TArray< float > CullValues;
+    if ( HoudiniGeoPartObject.HapiGetAttributeDataAsFloat(
+        AssetId, HAPI_UNREAL_ATTRIB_INSTANCE_CULL_START, AttributeInfo, CullValues, 1 ) &&
+        CullValues.Num() > 0 )
+    {
+        float StartCullDistance = CullValues[ 0 ];
+        for ( int32 Idx = 1; Idx < CullValues.Num(); ++Idx )
+            StartCullDistance = FMath::Min( StartCullDistance, CullValues[ Idx ] );
+
+        InstanceStartCullDistance = FMath::Max( 0, FMath::RoundToInt( StartCullDistance ) );
+    }
+
+    if ( HoudiniGeoPartObject.HapiGetAttributeDataAsFloat(
+        AssetId, HAPI_UNREAL_ATTRIB_INSTANCE_CULL_END, AttributeInfo, CullValues, 1 ) &&
+        CullValues.Num() > 0 )
+    {
+        float EndCullDistance = CullValues[ 0 ];
+        for ( int32 Idx = 1; Idx < CullValues.Num(); ++Idx )
+            EndCullDistance = FMath::Max( EndCullDistance, CullValues[ Idx ] );
+
+        InstanceEndCullDistance = FMath::Max( 0, FMath::RoundToInt( EndCullDistance ) );
     }
 }
 
@@ -139,6 +139,9 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInput : public UHoudiniAsset
         /** Return true if this is an attribute instancer with overrides. **/
         bool IsAttributeInstancerOverride() const;
 
+        /** Remove the foliage instances generated by all fields of this instancer. **/
+        void ClearFoliageInstances();
+
 #if WITH_EDITOR
 
         /** Clone all used instance static mesh components and and attach them to provided actor. **/
@@ -148,10 +151,8 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInput : public UHoudiniAsset
 
     protected:
 
-        /** Retrieve all transforms for a given path. Used by attribute instancer. **/
-        void GetPathInstaceTransforms(
-            const FString & ObjectInstancePath, const TArray< FString > & PointInstanceValues,
-            const TArray< FTransform > & Transforms, TArray< FTransform > & OutTransforms );
+        /** Read instancer output settings (hierarchical instancing, cull distances) for this cook. **/
+        void UpdateInstancerOutputSettings();
 
     protected:
 
@@ -162,13 +163,13 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInput : public UHoudiniAsset
         /** Locate or create (if it does not exist) an input field. **/
         void CreateInstanceInputField(
             const FHoudiniGeoPartObject & HoudiniGeoPartObject,
-            const TArray< FTransform > & ObjectTransforms, 
+            TArray< FTransform > ObjectTransforms,
             const TArray< UHoudiniAssetInstanceInputField * > & OldInstanceInputFields,
             TArray< UHoudiniAssetInstanceInputField * > & NewInstanceInputFields );
 
         /** Locate or create (if it does not exist) an input field. This version is used with override attribute. **/
         void CreateInstanceInputField(
-            UObject * InstancedObject, const TArray< FTransform > & ObjectTransforms,
+            UObject * InstancedObject, TArray< FTransform > ObjectTransforms,
             const TArray< UHoudiniAssetInstanceInputField * > & OldInstanceInputFields,
             TArray< UHoudiniAssetInstanceInputField * > & NewInstanceInputFields );
 
@@ -294,6 +295,10 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInput : public UHoudiniAsset
         /** Id of an object to instance. **/
         HAPI_NodeId ObjectToInstanceId;
 
+        /** Cull distances applied to generated instanced static mesh components, 0 means no culling. **/
+        int32 InstanceStartCullDistance;
+        int32 InstanceEndCullDistance;
+
         /** Flags used by this input. **/
         union
         {
@@ -307,6 +312,12 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInput : public UHoudiniAsset
 
                 /** Set to true if this is a packed primitive instancer **/
                 uint32 bIsPackedPrimitiveInstancer : 1;
+
+                /** Set to true if this instancer generates hierarchical instanced static mesh components. **/
+                uint32 bUseHierarchicalInstancer : 1;
+
+                /** Set to true if static mesh instances are written into the level's foliage instead. **/
+                uint32 bOutputToFoliage : 1;
             };
 
             uint32 HoudiniAssetInstanceInputFlagsPacked;
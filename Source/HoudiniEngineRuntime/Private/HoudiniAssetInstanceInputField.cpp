@@ -101,6 +101,17 @@ UHoudiniAssetInstanceInputField::Create(
             USceneComponent* NewISMC = DuplicateObject< USceneComponent >( OtherISMC, InRootComp );
             NewISMC->RegisterComponent();
             NewISMC->AttachToComponent( InRootComp, FAttachmentTransformRules::KeepRelativeTransform );
+
+            // Foliage output leaves the source component empty, its instances are copied from the level's foliage.
+            UInstancedStaticMeshComponent * NewInstancedComponent = Cast< UInstancedStaticMeshComponent >( NewISMC );
+            if ( NewInstancedComponent && NewInstancedComponent->GetInstanceCount() == 0 )
+            {
+                TArray< FTransform > FoliageTransforms;
+                FHoudiniEngineUtils::GetFoliageInstanceTransforms( OtherISMC, FoliageTransforms );
+                for ( const FTransform & FoliageTransform : FoliageTransforms )
+                    NewInstancedComponent->AddInstanceWorldSpace( FoliageTransform );
+            }
+
             InputField->InstancerComponents.Add( NewISMC );
         }
     }
@@ -219,7 +230,7 @@ UHoudiniAssetInstanceInputField::AddInstanceComponent( int32 VariationIdx )
         UInstancedStaticMeshComponent * InstancedStaticMeshComponent =
             NewObject< UInstancedStaticMeshComponent >(
                 RootComp->GetOwner(),
-                UInstancedStaticMeshComponent::StaticClass(),
+                GetInstancedStaticMeshComponentClass(),
                 NAME_None, RF_Transactional );
 
         InstancerComponents.Insert( InstancedStaticMeshComponent, VariationIdx );
@@ -282,13 +293,54 @@ UHoudiniAssetInstanceInputField::AddInstanceComponent( int32 VariationIdx )
     UpdateRelativeTransform();
 }
 
+UClass *
+UHoudiniAssetInstanceInputField::GetInstancedStaticMeshComponentClass() const
+{
+    if ( HoudiniAssetInstanceInput && HoudiniAssetInstanceInput->bUseHierarchicalInstancer )
+        return UHierarchicalInstancedStaticMeshComponent::StaticClass();
+
+    return UInstancedStaticMeshComponent::StaticClass();
+}
+
+void
+UHoudiniAssetInstanceInputField::UpdateInstancedStaticMeshComponentClasses()
+{
+    UClass * InstancedStaticMeshComponentClass = GetInstancedStaticMeshComponentClass();
+
+    for ( int32 Idx = 0; Idx < InstancerComponents.Num(); ++Idx )
+    {
+        UInstancedStaticMeshComponent * ISMC = Cast< UInstancedStaticMeshComponent >( InstancerComponents[ Idx ] );
+        if ( !ISMC || ISMC->GetClass() == InstancedStaticMeshComponentClass )
+            continue;
+
+        // The instancing mode has changed, we need to swap out the component.
+        FTransform SavedXform = ISMC->GetRelativeTransform();
+        FHoudiniEngineUtils::ClearFoliageInstances( ISMC );
+        ISMC->DestroyComponent();
+        InstancerComponents.RemoveAt( Idx );
+        AddInstanceComponent( Idx );
+        InstancerComponents[ Idx ]->SetRelativeTransform( SavedXform );
+    }
+}
+
 void
 UHoudiniAssetInstanceInputField::SetInstanceTransforms( const TArray< FTransform > & ObjectTransforms )
 {
+    UpdateInstancedStaticMeshComponentClasses();
+
     InstancedTransforms = ObjectTransforms;
     UpdateInstanceTransforms( true );
 }
 
+void
+UHoudiniAssetInstanceInputField::SetInstanceTransforms( TArray< FTransform > && ObjectTransforms )
+{
+    UpdateInstancedStaticMeshComponentClasses();
+
+    InstancedTransforms = MoveTemp( ObjectTransforms );
+    UpdateInstanceTransforms( true );
+}
+
 void
 UHoudiniAssetInstanceInputField::UpdateInstanceTransforms( bool RecomputeVariationAssignments )
 {
@@ -322,6 +374,38 @@ UHoudiniAssetInstanceInputField::UpdateInstanceTransforms( bool RecomputeVariati
 
     for ( int32 Idx = 0; Idx < VariationCount; Idx++ )
     {
+        // Apply the cull distances requested by the instancer.
+        UInstancedStaticMeshComponent * ISMC = Cast< UInstancedStaticMeshComponent >( InstancerComponents[ Idx ] );
+        if ( ISMC && HoudiniAssetInstanceInput &&
+            ( ISMC->InstanceStartCullDistance != HoudiniAssetInstanceInput->InstanceStartCullDistance ||
+              ISMC->InstanceEndCullDistance != HoudiniAssetInstanceInput->InstanceEndCullDistance ) )
+        {
+            ISMC->InstanceStartCullDistance = HoudiniAssetInstanceInput->InstanceStartCullDistance;
+            ISMC->InstanceEndCullDistance = HoudiniAssetInstanceInput->InstanceEndCullDistance;
+            ISMC->MarkRenderStateDirty();
+        }
+
+#if WITH_EDITOR
+        if ( ISMC && HoudiniAssetInstanceInput && HoudiniAssetInstanceInput->bOutputToFoliage )
+        {
+            // Instances live in the level's foliage, the component is only kept as their base.
+            UHoudiniAssetComponent * Comp = Cast< UHoudiniAssetComponent >( HoudiniAssetComponent );
+            FHoudiniEngineUtils::UpdateInstancedStaticMeshComponentInstances(
+                ISMC, TArray< FTransform >(), RotationOffsets[ Idx ], ScaleOffsets[ Idx ] );
+            FHoudiniEngineUtils::UpdateFoliageInstances(
+                ISMC, ISMC->GetStaticMesh(),
+                Comp ? Comp->GeneratedFoliageDefaultSettings : nullptr,
+                VariationTransformsArray[ Idx ],
+                RotationOffsets[ Idx ],
+                ScaleOffsets[ Idx ] );
+            continue;
+        }
+
+        // Foliage output may have been used by a previous cook.
+        if ( ISMC )
+            FHoudiniEngineUtils::ClearFoliageInstances( ISMC );
+#endif
+
         FHoudiniEngineUtils::UpdateInstancedStaticMeshComponentInstances(
             InstancerComponents[ Idx ],
             VariationTransformsArray[ Idx ],
@@ -330,6 +414,16 @@ UHoudiniAssetInstanceInputField::UpdateInstanceTransforms( bool RecomputeVariati
     }
 }
 
+void
+UHoudiniAssetInstanceInputField::ClearFoliageInstances()
+{
+    for ( USceneComponent * Comp : InstancerComponents )
+    {
+        if ( Cast< UInstancedStaticMeshComponent >( Comp ) )
+            FHoudiniEngineUtils::ClearFoliageInstances( Comp );
+    }
+}
+
 void
 UHoudiniAssetInstanceInputField::UpdateRelativeTransform()
 {
@@ -398,6 +492,7 @@ UHoudiniAssetInstanceInputField::RemoveInstanceVariation( int32 VariationIdx )
     // Remove instanced component.
     if ( USceneComponent* Comp = InstancerComponents[ VariationIdx ] )
     {
+        FHoudiniEngineUtils::ClearFoliageInstances( Comp );
         Comp->DestroyComponent();
     }
     InstancerComponents.RemoveAt( VariationIdx );
@@ -444,6 +539,7 @@ UHoudiniAssetInstanceInputField::ReplaceInstanceVariation( UObject * InObject, i
     {
         // We'll create a new InstanceComponent
         FTransform SavedXform = InstancerComponents[ Index ]->GetRelativeTransform();
+        FHoudiniEngineUtils::ClearFoliageInstances( InstancerComponents[ Index ] );
         InstancerComponents[ Index ]->DestroyComponent();
         InstancerComponents.RemoveAt( Index );
         AddInstanceComponent( Index );
@@ -160,13 +160,23 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetInstanceInputField : public UObject
         /** Recreates physics states for instanced static mesh component. **/
         void RecreatePhysicsState();
 
+        /** Remove the foliage instances based on the components of this field. **/
+        void ClearFoliageInstances();
+
     protected:
 
         /** Create instanced component for this field. **/
         void AddInstanceComponent( int32 VariationIdx );
 
+        /** Return the instanced static mesh component class requested by the owner instancer. **/
+        UClass * GetInstancedStaticMeshComponentClass() const;
+
+        /** Recreate instanced static mesh components whose class no longer matches the requested one. **/
+        void UpdateInstancedStaticMeshComponentClasses();
+
         /** Set transforms for this field. **/
         void SetInstanceTransforms( const TArray< FTransform > & ObjectTransforms );
+        void SetInstanceTransforms( TArray< FTransform > && ObjectTransforms );
 
         /** Update relative transform for this field. **/
         void UpdateRelativeTransform();
@@ -206,6 +206,15 @@ UHoudiniAssetParameter::UploadParameterValue()
     return true;
 }
 
+bool
+UHoudiniAssetParameter::RefreshParameterValue(
+    const TArray< int32 > & IntValues, const TArray< float > & FloatValues,
+    const TArray< HAPI_StringHandle > & StringValues )
+{
+    // Default implementation has no value.
+    return false;
+}
+
 bool
 UHoudiniAssetParameter::SetParameterVariantValue( const FVariant& Variant, int32 Idx, bool bTriggerModify, bool bRecordUndo )
 {
@@ -97,6 +97,11 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameter : public UObject
         /** Upload parameter value to HAPI. **/
         virtual bool UploadParameterValue();
 
+        /** Update parameter value from the values of all the node's parameters, return true if it changed. **/
+        virtual bool RefreshParameterValue(
+            const TArray< int32 > & IntValues, const TArray< float > & FloatValues,
+            const TArray< HAPI_StringHandle > & StringValues );
+
         /** Set parameter value. **/
         virtual bool SetParameterVariantValue(
             const FVariant & Variant,
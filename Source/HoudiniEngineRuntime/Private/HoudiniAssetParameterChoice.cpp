@@ -328,6 +328,48 @@ UHoudiniAssetParameterChoice::UploadParameterValue()
     return Super::UploadParameterValue();
 }
 
+bool
+UHoudiniAssetParameterChoice::RefreshParameterValue(
+    const TArray< int32 > & IntValues, const TArray< float > & FloatValues,
+    const TArray< HAPI_StringHandle > & StringValues )
+{
+    if ( !bStringChoiceList )
+    {
+        if ( !IntValues.IsValidIndex( ValuesIndex ) || CurrentValue == IntValues[ ValuesIndex ] )
+            return false;
+
+        CurrentValue = IntValues[ ValuesIndex ];
+        return true;
+    }
+
+    if ( !StringValues.IsValidIndex( ValuesIndex ) )
+        return false;
+
+    FString NewStringValue;
+    FHoudiniEngineString HoudiniEngineString( StringValues[ ValuesIndex ] );
+    if ( !HoudiniEngineString.ToFString( NewStringValue ) )
+        return false;
+
+    // The selection is displayed with its label, like when the parameter is created.
+    int32 NewValue = CurrentValue;
+    for ( int32 ChoiceIdx = 0; ChoiceIdx < StringChoiceValues.Num(); ++ChoiceIdx )
+    {
+        if ( StringChoiceValues[ ChoiceIdx ]->Equals( NewStringValue ) && StringChoiceLabels.IsValidIndex( ChoiceIdx ) )
+        {
+            NewStringValue = *StringChoiceLabels[ ChoiceIdx ];
+            NewValue = ChoiceIdx;
+            break;
+        }
+    }
+
+    if ( NewValue == CurrentValue && NewStringValue.Equals( StringValue, ESearchCase::CaseSensitive ) )
+        return false;
+
+    CurrentValue = NewValue;
+    StringValue = NewStringValue;
+    return true;
+}
+
 bool
 UHoudiniAssetParameterChoice::SetParameterVariantValue( const FVariant & Variant, int32 Idx, bool bTriggerModify, bool bRecordUndo )
 {
@@ -164,6 +164,23 @@ UHoudiniAssetParameterColor::UploadParameterValue()
     return Super::UploadParameterValue();
 }
 
+bool
+UHoudiniAssetParameterColor::RefreshParameterValue(
+    const TArray< int32 > & IntValues, const TArray< float > & FloatValues,
+    const TArray< HAPI_StringHandle > & StringValues )
+{
+    if ( ValuesIndex < 0 || TupleSize > 4 || ValuesIndex + TupleSize > FloatValues.Num() )
+        return false;
+
+    FLinearColor NewColor = Color;
+    FMemory::Memcpy( &NewColor.R, &FloatValues[ ValuesIndex ], TupleSize * sizeof( float ) );
+    if ( NewColor == Color )
+        return false;
+
+    Color = NewColor;
+    return true;
+}
+
 bool
 UHoudiniAssetParameterColor::SetParameterVariantValue( const FVariant& Variant, int32 Idx, bool bTriggerModify, bool bRecordUndo )
 {
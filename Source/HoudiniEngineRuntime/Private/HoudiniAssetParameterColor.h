@@ -78,6 +78,11 @@ class HOUDINIENGINERUNTIME_API UHoudiniAssetParameterColor : public UHoudiniAsse
         /** Upload parameter value to HAPI. **/
         virtual bool UploadParameterValue() override;
 
+        /** Update parameter value from the values of all the node's parameters. **/
+        virtual bool RefreshParameterValue(
+            const TArray< int32 > & IntValues, const TArray< float > & FloatValues,
+            const TArray< HAPI_StringHandle > & StringValues ) override;
+
         /** Set parameter value. **/
         virtual bool SetParameterVariantValue(
             const FVariant & Variant, int32 Idx = 0, bool bTriggerModify = true,
@@ -231,6 +231,34 @@ UHoudiniAssetParameterFile::UploadParameterValue()
     return Super::UploadParameterValue();
 }
 
+bool
+UHoudiniAssetParameterFile::RefreshParameterValue(
+    const TArray< int32 > & IntValues, const TArray< float > & FloatValues,
+    const TArray< HAPI_StringHandle > & StringValues )
+{
+    if ( ValuesIndex < 0 || ValuesIndex + TupleSize > StringValues.Num() || Values.Num() != TupleSize )
+        return false;
+
+    bool bValueChanged = false;
+    for ( int32 Idx = 0; Idx < TupleSize; ++Idx )
+    {
+        FString ValueString = TEXT( "" );
+        FHoudiniEngineString HoudiniEngineString( StringValues[ ValuesIndex + Idx ] );
+        HoudiniEngineString.ToFString( ValueString );
+
+        // Detect and update relative paths.
+        ValueString = UpdateCheckRelativePath( ValueString );
+
+        if ( !Values[ Idx ].Equals( ValueString, ESearchCase::CaseSensitive ) )
+        {
+            Values[ Idx ] = ValueString;
+            bValueChanged = true;
+        }
+    }
+
+    return bValueChanged;
+}
+
 bool
 UHoudiniAssetParameterFile::SetParameterVariantValue(
     const FVariant & Variant, int32 Idx, bool bTriggerModify,
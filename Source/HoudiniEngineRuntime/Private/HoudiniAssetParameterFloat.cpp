@@ -330,6 +330,27 @@ UHoudiniAssetParameterFloat::UploadParameterValue()
     return Super::UploadParameterValue();
 }
 
+bool
+UHoudiniAssetParameterFloat::RefreshParameterValue(
+    const TArray< int32 > & IntValues, const TArray< float > & FloatValues,
+    const TArray< HAPI_StringHandle > & StringValues )
+{
+    if ( ValuesIndex < 0 || ValuesIndex + TupleSize > FloatValues.Num() || Values.Num() != TupleSize )
+        return false;
+
+    bool bValueChanged = false;
+    for ( int32 Idx = 0; Idx < TupleSize; ++Idx )
+    {
+        if ( Values[ Idx ] != FloatValues[ ValuesIndex + Idx ] )
+        {
+            Values[ Idx ] = FloatValues[ ValuesIndex + Idx ];
+            bValueChanged = true;
+        }
+    }
+
+    return bValueChanged;
+}
+
 bool
 UHoudiniAssetParameterFloat::SetParameterVariantValue( const FVariant & Variant, int32 Idx, bool bTriggerModify, bool bRecordUndo )
 {
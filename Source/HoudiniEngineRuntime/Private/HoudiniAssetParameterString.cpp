@@ -181,6 +181,31 @@ UHoudiniAssetParameterString::UploadParameterValue()
     return Super::UploadParameterValue();
 }
 
+bool
+UHoudiniAssetParameterString::RefreshParameterValue(
+    const TArray< int32 > & IntValues, const TArray< float > & FloatValues,
+    const TArray< HAPI_StringHandle > & StringValues )
+{
+    if ( ValuesIndex < 0 || ValuesIndex + TupleSize > StringValues.Num() || Values.Num() != TupleSize )
+        return false;
+
+    bool bValueChanged = false;
+    for ( int32 Idx = 0; Idx < TupleSize; ++Idx )
+    {
+        FString ValueString = TEXT( "" );
+        FHoudiniEngineString HoudiniEngineString( StringValues[ ValuesIndex + Idx ] );
+        HoudiniEngineString.ToFString( ValueString );
+
+        if ( !Values[ Idx ].Equals( ValueString, ESearchCase::CaseSensitive ) )
+        {
+            Values[ Idx ] = ValueString;
+            bValueChanged = true;
+        }
+    }
+
+    return bValueChanged;
+}
+
 bool
 UHoudiniAssetParameterString::SetParameterVariantValue(
     const FVariant & Variant, int32 Idx, bool bTriggerModify, bool bRecordUndo )
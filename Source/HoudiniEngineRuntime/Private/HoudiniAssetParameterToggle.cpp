@@ -198,6 +198,27 @@ UHoudiniAssetParameterToggle::UploadParameterValue()
     return Super::UploadParameterValue();
 }
 
+bool
+UHoudiniAssetParameterToggle::RefreshParameterValue(
+    const TArray< int32 > & IntValues, const TArray< float > & FloatValues,
+    const TArray< HAPI_StringHandle > & StringValues )
+{
+    if ( ValuesIndex < 0 || ValuesIndex + TupleSize > IntValues.Num() || Values.Num() != TupleSize )
+        return false;
+
+    bool bValueChanged = false;
+    for ( int32 Idx = 0; Idx < TupleSize; ++Idx )
+    {
+        if ( Values[ Idx ] != IntValues[ ValuesIndex + Idx ] )
+        {
+            Values[ Idx ] = IntValues[ ValuesIndex + Idx ];
+            bValueChanged = true;
+        }
+    }
+
+    return bValueChanged;
+}
+
 bool
 UHoudiniAssetParameterToggle::SetParameterVariantValue(
     const FVariant & Variant, int32 Idx, bool bTriggerModify, bool bRecordUndo )
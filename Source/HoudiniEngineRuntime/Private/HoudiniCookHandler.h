@@ -22,6 +22,7 @@ public:
     virtual void ClearAssignmentMaterials() = 0;
     virtual void AddAssignmentMaterial( const FString& MaterialName, class UMaterialInterface* MaterialInterface ) = 0;
     virtual class UMaterialInterface * GetReplacementMaterial( const struct FHoudiniGeoPartObject& GeoPartObject, const FString& MaterialName) = 0;
+    virtual class UMaterialInterface * LoadAttributeMaterial( const FString& MaterialPath ) = 0;
 };
 
 struct FHoudiniCookParams
@@ -119,6 +119,18 @@ FHoudiniEngine::SetHapiState( HAPI_Result Result )
     HAPIState = Result;
 }
 
+TMap< TWeakObjectPtr< UStaticMesh >, FHoudiniEngineSharedMeshInput > &
+FHoudiniEngine::GetSharedMeshInputs()
+{
+    return SharedMeshInputs;
+}
+
+TMap< HAPI_NodeId, TWeakObjectPtr< UStaticMesh > > &
+FHoudiniEngine::GetSharedMeshInputReferences()
+{
+    return SharedMeshInputReferences;
+}
+
 const HAPI_Session *
 FHoudiniEngine::GetSession() const
 {
@@ -445,6 +457,10 @@ FHoudiniEngine::ShutdownModule()
         HoudiniEngineScheduler = nullptr;
     }
 
+    // The shared input nodes die with the session.
+    SharedMeshInputs.Empty();
+    SharedMeshInputReferences.Empty();
+
     // Perform HAPI finalization.
     if ( FHoudiniApi::IsHAPIInitialized() )
         FHoudiniApi::Cleanup( GetSession() );
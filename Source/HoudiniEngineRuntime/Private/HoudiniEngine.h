@@ -39,6 +39,19 @@ class UStaticMesh;
 class FRunnableThread;
 class FHoudiniEngineScheduler;
 
+/** Input node holding the geometry of a static mesh, shared by all the inputs of the session using that mesh. **/
+struct FHoudiniEngineSharedMeshInput
+{
+    /** Input node the mesh has been uploaded to. **/
+    HAPI_NodeId NodeId = -1;
+
+    /** Key of the uploaded geometry, see FHoudiniEngineUtils::GetStaticMeshInputKey. **/
+    uint32 MeshKey = 0;
+
+    /** Number of object merge nodes referencing the input node. **/
+    int32 RefCount = 0;
+};
+
 class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
 {
     public:
@@ -86,6 +99,12 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
         /** Return true if singleton instance has been created. **/
         static bool IsInitialized();
 
+        /** Return the static mesh input nodes shared by the inputs of the session. **/
+        TMap< TWeakObjectPtr< UStaticMesh >, FHoudiniEngineSharedMeshInput > & GetSharedMeshInputs();
+
+        /** Return the object merge nodes referencing a shared static mesh input node, and their mesh. **/
+        TMap< HAPI_NodeId, TWeakObjectPtr< UStaticMesh > > & GetSharedMeshInputReferences();
+
     private:
 
         /** Singleton instance of Houdini Engine. **/
@@ -115,6 +134,12 @@ class HOUDINIENGINERUNTIME_API FHoudiniEngine : public IHoudiniEngine
         /** Map of task statuses. **/
         TMap< FGuid, FHoudiniEngineTaskInfo > TaskInfos;
 
+        /** Static mesh input nodes shared by the inputs of the session. **/
+        TMap< TWeakObjectPtr< UStaticMesh >, FHoudiniEngineSharedMeshInput > SharedMeshInputs;
+
+        /** Object merge nodes referencing a shared static mesh input node. **/
+        TMap< HAPI_NodeId, TWeakObjectPtr< UStaticMesh > > SharedMeshInputReferences;
+
         /** Thread used to execute the scheduler. **/
         FRunnableThread * HoudiniEngineSchedulerThread;
 
@@ -116,6 +116,7 @@
 #include "Curves/CurveFloat.h"
 #include "Curves/CurveLinearColor.h"
 #include "Components/InstancedStaticMeshComponent.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
 #include "StaticMeshResources.h"
 #include "ImageUtils.h"
 #include "Internationalization/Internationalization.h"
@@ -251,8 +252,13 @@
 #define HAPI_UNREAL_ATTRIB_LANDSCAPE_VERTEX_INDEX       "unreal_vertex_index"
 //#define HAPI_UNREAL_ATTRIB_LANDSCAPE_NAME               "unreal_landscape"
 #define HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME              "unreal_input_mesh_name"
+#define HAPI_UNREAL_ATTRIB_INPUT_MESH_INDEX             "unreal_input_mesh_index"
 #define HAPI_UNREAL_ATTRIB_MESH_SOCKET_NAME             "unreal_mesh_socket_name"
 #define HAPI_UNREAL_ATTRIB_MESH_SOCKET_ACTOR            "unreal_mesh_socket_actor"
+#define HAPI_UNREAL_ATTRIB_HIERARCHICAL_INSTANCER       "unreal_hierarchical_instancer"
+#define HAPI_UNREAL_ATTRIB_INSTANCE_CULL_START          "unreal_instance_cull_distance_start"
+#define HAPI_UNREAL_ATTRIB_INSTANCE_CULL_END            "unreal_instance_cull_distance_end"
+#define HAPI_UNREAL_ATTRIB_FOLIAGE_INSTANCER            "unreal_foliage"
 
 /** Names of other Houdini Engine attributes and parameters. **/
 #define HAPI_UNREAL_ATTRIB_INSTANCE                     "instance"
@@ -263,6 +269,8 @@
 #define HAPI_UNREAL_ATTRIB_ROTATION                     "rot"
 #define HAPI_UNREAL_ATTRIB_SCALE                        "scale"
 #define HAPI_UNREAL_ATTRIB_UNIFORM_SCALE                "pscale"
+#define HAPI_UNREAL_ATTRIB_ORIENT                       "orient"
+#define HAPI_UNREAL_ATTRIB_PIVOT                        "pivot"
 #define HAPI_UNREAL_ATTRIB_COLOR                        HAPI_ATTRIB_COLOR
 #define HAPI_UNREAL_ATTRIB_ALPHA                        "Alpha"
 #define HAPI_UNREAL_ATTRIB_LIGHTMAP_COLOR               "unreal_lightmap_color"
@@ -284,6 +292,10 @@
 #define HAPI_UNREAL_PARAM_UNIFORMSCALE                  "scale"
 
 #define HAPI_UNREAL_PARAM_FILE                          "file"
+#define HAPI_UNREAL_PARAM_OBJECT_MERGE_PATH             "objpath1"
+#define HAPI_UNREAL_PARAM_OBJECT_MERGE_TRANSFORM_TYPE   "xformtype"
+#define HAPI_UNREAL_PARAM_COPY_TO_POINTS_PACK           "pack"
+#define HAPI_UNREAL_PARAM_COPY_TO_POINTS_TARGET_GROUP   "targetgroup"
 
 /** Handle types. **/
 #define HAPI_UNREAL_HANDLE_TRANSFORM                    "xform"
@@ -368,6 +380,7 @@
 /** Default values for new curves. **/
 #define HAPI_UNREAL_PARAM_INPUT_CURVE_COORDS_DEFAULT    "0.0, 0.0, 3.0 3.0, 0.0, 3.0"
 #define HAPI_UNREAL_PARAM_SPLINE_RESOLUTION_DEFAULT	50.0f
+#define HAPI_UNREAL_CURVE_ORDER_DEFAULT                 4
 
 /** Default values for certain UI min and max parameter values **/
 #define HAPI_UNREAL_PARAM_INT_UI_MIN                    0
@@ -433,6 +446,30 @@
 #define HAPI_UNREAL_SCALE_FACTOR_POSITION                   100.0f
 #define HAPI_UNREAL_SCALE_FACTOR_TRANSLATION                100.0f
 
+/** Heightfields larger than this (in points per side) are split into landscape streaming proxies. **/
+#define HAPI_UNREAL_LANDSCAPE_TILE_SIZE_DEFAULT             4033
+
+/** Number of instance transforms fetched and converted per chunk. **/
+#define HAPI_UNREAL_INSTANCE_TRANSFORM_CHUNK_SIZE           4096
+
+/** Size of the square blocks used when transposing heightfield data to landscape order. **/
+#define HAPI_UNREAL_LANDSCAPE_CONVERSION_BLOCK_SIZE         64
+
+/** Size of the tiles used when uploading volumes, HAPI 3.0 only sets volumes by 8x8x8 tiles. **/
+#define HAPI_UNREAL_VOLUME_TILE_SIZE                        8
+
+/** Number of landscape components whose data interfaces are held at once when exporting a landscape input. **/
+#define HAPI_UNREAL_LANDSCAPE_EXPORT_BATCH_SIZE             64
+
+/** Number of heightfield values transferred per call, heightfields are always transferred in whole rows. **/
+#define HAPI_UNREAL_HEIGHTFIELD_TRANSFER_CHUNK_SIZE         1048576
+
+/** Number of heightfield values reduced per task when computing their min/max. **/
+#define HAPI_UNREAL_LANDSCAPE_MINMAX_CHUNK_SIZE             65536
+
+/** Format of the geometry buffers sent to Houdini when uploading inputs. **/
+#define HAPI_UNREAL_GEO_BUFFER_FORMAT                       "geo"
+
 /** Small value used for comparisons. **/
 #define HAPI_UNREAL_SCALE_SMALL_VALUE                       KINDA_SMALL_NUMBER * 2.0f
 
@@ -39,11 +39,13 @@
 #include "HoudiniAssetComponentMaterials.h"
 #include "HoudiniAsset.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniGeoEncoder.h"
 #include "HoudiniAttributeDataComponent.h"
 #include "Components/SplineComponent.h"
 #include "LandscapeInfo.h"
 #include "LandscapeComponent.h"
 #include "HoudiniInstancedActorComponent.h"
+#include "HoudiniLandscapeUtils.h"
 
 #include "CoreMinimal.h"
 #include "AI/Navigation/NavCollision.h"
@@ -51,6 +53,11 @@
 #include "Engine/MapBuildDataRegistry.h"
 #include "LightMap.h"
 #include "Engine/StaticMeshActor.h"
+#include "Async/ParallelFor.h"
+#include "Async/Async.h"
+#include "InstancedFoliage.h"
+#include "InstancedFoliageActor.h"
+#include "FoliageType_InstancedStaticMesh.h"
 #if WITH_EDITOR
     #include "ActorFactories/ActorFactory.h"
     #include "Editor.h"
@@ -58,6 +65,7 @@
     #include "ActorFactories/ActorFactoryStaticMesh.h"
     #include "Interfaces/ITargetPlatform.h"
     #include "Interfaces/ITargetPlatformManagerModule.h"
+    #include "LandscapeEdit.h"
 #endif
 #include "EngineUtils.h"
 #include "MetaData.h"
@@ -350,6 +358,9 @@ FHoudiniEngineUtils::IsHoudiniAssetValid( HAPI_NodeId AssetId )
 bool
 FHoudiniEngineUtils::DestroyHoudiniAsset( HAPI_NodeId AssetId )
 {
+    // Object merges of shared mesh inputs release their reference.
+    FHoudiniEngineUtils::HapiReleaseSharedInputNode( AssetId );
+
     return FHoudiniApi::DeleteNode( FHoudiniEngine::Get().GetSession(), AssetId ) == HAPI_RESULT_SUCCESS;
 }
 
@@ -409,6 +420,16 @@ FHoudiniEngineUtils::GetUniqueMaterialShopName( HAPI_NodeId AssetId, HAPI_NodeId
 void
 FHoudiniEngineUtils::TranslateHapiTransform( const HAPI_Transform & HapiTransform, FTransform & UnrealTransform )
 {
+    FHoudiniEngineUtils::TranslateHapiTransforms( &HapiTransform, &UnrealTransform, 1 );
+}
+
+void
+FHoudiniEngineUtils::TranslateHapiTransforms(
+    const HAPI_Transform * HapiTransforms, FTransform * UnrealTransforms, int32 TransformCount )
+{
+    if ( TransformCount <= 0 )
+        return;
+
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
 
     float TransformScaleFactor = HAPI_UNREAL_SCALE_FACTOR_TRANSLATION;
@@ -420,40 +441,44 @@ FHoudiniEngineUtils::TranslateHapiTransform( const HAPI_Transform & HapiTransfor
         ImportAxis = HoudiniRuntimeSettings->ImportAxis;
     }
 
-    if ( ImportAxis == HRSAI_Unreal )
+    if ( ImportAxis != HRSAI_Unreal && ImportAxis != HRSAI_Houdini )
     {
-        FQuat ObjectRotation(
-            HapiTransform.rotationQuaternion[ 0 ], HapiTransform.rotationQuaternion[ 1 ],
-            HapiTransform.rotationQuaternion[ 2 ],  -HapiTransform.rotationQuaternion[ 3 ]);
-        Swap( ObjectRotation.Y, ObjectRotation.Z );
-
-        FVector ObjectTranslation( HapiTransform.position[ 0 ], HapiTransform.position[ 1 ], HapiTransform.position[ 2 ] );
-        ObjectTranslation *= TransformScaleFactor;
-        Swap( ObjectTranslation[ 2 ], ObjectTranslation[ 1 ] );
-
-        FVector ObjectScale3D( HapiTransform.scale[ 0 ], HapiTransform.scale[ 1 ], HapiTransform.scale[ 2 ] );
-        Swap( ObjectScale3D.Y, ObjectScale3D.Z );
-
-        UnrealTransform.SetComponents( ObjectRotation, ObjectTranslation, ObjectScale3D );
+        // Not valid enum value.
+        check( 0 );
+        return;
     }
-    else if ( ImportAxis == HRSAI_Houdini )
-    {
-        FQuat ObjectRotation(
-            HapiTransform.rotationQuaternion[ 0 ], HapiTransform.rotationQuaternion[ 1 ],
-            HapiTransform.rotationQuaternion[ 2 ], HapiTransform.rotationQuaternion[ 3 ] );
 
-        FVector ObjectTranslation(
-            HapiTransform.position[ 0 ], HapiTransform.position[ 1 ], HapiTransform.position[ 2 ] );
-        ObjectTranslation *= TransformScaleFactor;
-
-        FVector ObjectScale3D( HapiTransform.scale[ 0 ], HapiTransform.scale[ 1 ], HapiTransform.scale[ 2 ] );
-
-        UnrealTransform.SetComponents( ObjectRotation, ObjectTranslation, ObjectScale3D );
+    // Settings are resolved once, the loops below only shuffle components.
+    if ( ImportAxis == HRSAI_Unreal )
+    {
+        // Swap Y and Z and flip the rotation handedness.
+        for ( int32 Idx = 0; Idx < TransformCount; ++Idx )
+        {
+            const HAPI_Transform & HapiTransform = HapiTransforms[ Idx ];
+            UnrealTransforms[ Idx ] = FTransform(
+                FQuat(
+                    HapiTransform.rotationQuaternion[ 0 ], HapiTransform.rotationQuaternion[ 2 ],
+                    HapiTransform.rotationQuaternion[ 1 ], -HapiTransform.rotationQuaternion[ 3 ] ),
+                FVector(
+                    HapiTransform.position[ 0 ], HapiTransform.position[ 2 ],
+                    HapiTransform.position[ 1 ] ) * TransformScaleFactor,
+                FVector( HapiTransform.scale[ 0 ], HapiTransform.scale[ 2 ], HapiTransform.scale[ 1 ] ) );
+        }
     }
     else
     {
-        // Not valid enum value.
-        check( 0 );
+        for ( int32 Idx = 0; Idx < TransformCount; ++Idx )
+        {
+            const HAPI_Transform & HapiTransform = HapiTransforms[ Idx ];
+            UnrealTransforms[ Idx ] = FTransform(
+                FQuat(
+                    HapiTransform.rotationQuaternion[ 0 ], HapiTransform.rotationQuaternion[ 1 ],
+                    HapiTransform.rotationQuaternion[ 2 ], HapiTransform.rotationQuaternion[ 3 ] ),
+                FVector(
+                    HapiTransform.position[ 0 ], HapiTransform.position[ 1 ],
+                    HapiTransform.position[ 2 ] ) * TransformScaleFactor,
+                FVector( HapiTransform.scale[ 0 ], HapiTransform.scale[ 1 ], HapiTransform.scale[ 2 ] ) );
+        }
     }
 }
 
@@ -701,6 +726,48 @@ FHoudiniEngineUtils::HapiGetGroupMembership(
     return true;
 }
 
+bool
+FHoudiniEngineUtils::HapiGetGroupMembershipBits(
+    HAPI_NodeId GeoId, const HAPI_PartInfo & PartInfo, HAPI_GroupType GroupType,
+    const TArray< FString > & GroupNames, TArray< TBitArray<> > & GroupMemberships )
+{
+    GroupMemberships.SetNum( GroupNames.Num() );
+
+    HAPI_PartInfo PartInfoCopy = PartInfo;
+    int32 ElementCount = FHoudiniEngineUtils::HapiGetElementCountByGroupType( GroupType, PartInfoCopy );
+
+    // Membership buffer is shared by all groups, only the packed bits are kept per group.
+    TArray< int32 > GroupMembership;
+    GroupMembership.SetNumUninitialized( ElementCount );
+
+    bool bSuccess = true;
+    for ( int32 GroupIdx = 0; GroupIdx < GroupNames.Num(); ++GroupIdx )
+    {
+        TBitArray<> & GroupBits = GroupMemberships[ GroupIdx ];
+        GroupBits.Init( false, ElementCount );
+
+        if ( ElementCount <= 0 )
+            continue;
+
+        std::string ConvertedGroupName = TCHAR_TO_UTF8( *GroupNames[ GroupIdx ] );
+        if ( FHoudiniApi::GetGroupMembership(
+            FHoudiniEngine::Get().GetSession(), GeoId, PartInfo.id, GroupType,
+            ConvertedGroupName.c_str(), NULL, &GroupMembership[ 0 ], 0, ElementCount ) != HAPI_RESULT_SUCCESS )
+        {
+            bSuccess = false;
+            continue;
+        }
+
+        for ( int32 ElementIdx = 0; ElementIdx < ElementCount; ++ElementIdx )
+        {
+            if ( GroupMembership[ ElementIdx ] > 0 )
+                GroupBits[ ElementIdx ] = true;
+        }
+    }
+
+    return bSuccess;
+}
+
 bool
 FHoudiniEngineUtils::HapiCheckGroupMembership(
     const FHoudiniGeoPartObject & HoudiniGeoPartObject, HAPI_GroupType GroupType, const FString & GroupName )
@@ -998,22 +1065,7 @@ FHoudiniEngineUtils::HapiGetInstanceTransforms(
     if ( PartInfo.pointCount == 0 )
         return false;
 
-    TArray< HAPI_Transform > InstanceTransforms;
-    InstanceTransforms.SetNumZeroed( PartInfo.pointCount );
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetInstanceTransforms(
-        FHoudiniEngine::Get().GetSession(),
-        GeoId, HAPI_SRT, &InstanceTransforms[ 0 ],
-        0, PartInfo.pointCount ), false );
-
-    for ( int32 Idx = 0; Idx < PartInfo.pointCount; ++Idx )
-    {
-        const HAPI_Transform& HapiInstanceTransform = InstanceTransforms[ Idx ];
-        FTransform TransformMatrix;
-        FHoudiniEngineUtils::TranslateHapiTransform( HapiInstanceTransform, TransformMatrix );
-        Transforms.Add( TransformMatrix );
-    }
-
-    return true;
+    return FHoudiniEngineUtils::HapiFetchInstanceTransforms( GeoId, -1, PartInfo.pointCount, Transforms );
 }
 
 bool
@@ -1026,6 +1078,65 @@ FHoudiniEngineUtils::HapiGetInstanceTransforms(
         HoudiniGeoPartObject.GeoId, HoudiniGeoPartObject.PartId, Transforms );
 }
 
+bool
+FHoudiniEngineUtils::HapiFetchInstanceTransforms(
+    HAPI_NodeId GeoId, HAPI_PartId InstancerPartId, int32 InstanceCount, TArray< FTransform > & Transforms )
+{
+    Transforms.SetNumUninitialized( FMath::Max( InstanceCount, 0 ) );
+    if ( InstanceCount <= 0 )
+        return true;
+
+    // Raw transforms are fetched one chunk at a time on this thread, while the previous chunk is translated
+    // straight into the output array on a worker. Two staging buffers are enough, since each translation is
+    // waited for before the next one starts.
+    const int32 StagingSize = FMath::Min( InstanceCount, (int32) HAPI_UNREAL_INSTANCE_TRANSFORM_CHUNK_SIZE );
+    TArray< HAPI_Transform > HapiTransforms[ 2 ];
+    HapiTransforms[ 0 ].SetNumUninitialized( StagingSize );
+    HapiTransforms[ 1 ].SetNumUninitialized( StagingSize );
+
+    TFuture< void > PendingTranslation;
+    int32 ChunkIdx = 0;
+    for ( int32 StartIdx = 0; StartIdx < InstanceCount; StartIdx += HAPI_UNREAL_INSTANCE_TRANSFORM_CHUNK_SIZE, ++ChunkIdx )
+    {
+        const int32 ChunkSize = FMath::Min( InstanceCount - StartIdx, (int32) HAPI_UNREAL_INSTANCE_TRANSFORM_CHUNK_SIZE );
+        HAPI_Transform * ChunkTransforms = HapiTransforms[ ChunkIdx % 2 ].GetData();
+
+        HAPI_Result Result = HAPI_RESULT_SUCCESS;
+        if ( InstancerPartId < 0 )
+        {
+            Result = FHoudiniApi::GetInstanceTransforms(
+                FHoudiniEngine::Get().GetSession(), GeoId, HAPI_SRT,
+                ChunkTransforms, StartIdx, ChunkSize );
+        }
+        else
+        {
+            Result = FHoudiniApi::GetInstancerPartTransforms(
+                FHoudiniEngine::Get().GetSession(), GeoId, InstancerPartId, HAPI_RSTORDER_DEFAULT,
+                ChunkTransforms, StartIdx, ChunkSize );
+        }
+
+        if ( PendingTranslation.IsValid() )
+            PendingTranslation.Wait();
+
+        if ( Result != HAPI_RESULT_SUCCESS )
+        {
+            HOUDINI_LOG_ERROR( TEXT( "Hapi failed: %s" ), *FHoudiniEngineUtils::GetErrorDescription() );
+            Transforms.Empty();
+            return false;
+        }
+
+        FTransform * ChunkUnrealTransforms = &Transforms[ StartIdx ];
+        PendingTranslation = Async< void >( EAsyncExecution::TaskGraph, [ ChunkTransforms, ChunkUnrealTransforms, ChunkSize ]()
+        {
+            FHoudiniEngineUtils::TranslateHapiTransforms( ChunkTransforms, ChunkUnrealTransforms, ChunkSize );
+        } );
+    }
+
+    PendingTranslation.Wait();
+
+    return true;
+}
+
 bool
 FHoudiniEngineUtils::HapiGetImagePlanes(
     HAPI_ParmId NodeParmId, const HAPI_MaterialInfo & MaterialInfo,
@@ -1559,6 +1670,15 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
         ConnectedAssetId, HAPI_UNREAL_PARAM_CURVE_CLOSED,
         1, CurveClosed);
 
+    // Curves built from CVs use the points as their control points, they are sent directly as float attributes.
+    // Only the breakpoints and freehand methods need the curve SOP to generate the control points from the coords.
+    if (CurveMethodValue == 0)
+    {
+        return FHoudiniEngineUtils::HapiUploadCurveInputNodeData(
+            ConnectedAssetId, CurveTypeValue, CurveClosed != 0,
+            *Positions, Rotations, Scales3d, UniformScales);
+    }
+
     // For closed NURBS (CVs and Breakpoints), we have to close the curve manually, by duplicating its last point
     // in order to be able to set the rotations and scales attributes properly.
     bool bCloseCurveManually = false;
@@ -2243,6 +2363,240 @@ FHoudiniEngineUtils::HapiCreateCurveInputNodeForData(
     return true;
 }
 
+bool
+FHoudiniEngineUtils::HapiUploadCurveInputNodeData(
+    HAPI_NodeId CurveNodeId, int32 CurveType, bool bClosed,
+    const TArray< FVector > & Positions,
+    const TArray< FQuat > * Rotations,
+    const TArray< FVector > * Scales3d,
+    const TArray< float > * UniformScales )
+{
+#if WITH_EDITOR
+
+    if ( Positions.Num() < 2 )
+        return false;
+
+    // Index of the input point used by each point of the curve, as closed and bezier curves repeat some of them.
+    TArray< int32 > PointIndices;
+    PointIndices.SetNumUninitialized( Positions.Num() );
+    for ( int32 Idx = 0; Idx < Positions.Num(); ++Idx )
+        PointIndices[ Idx ] = Idx;
+
+    int32 Order = 2;
+    bool bIsCurve = true;
+    if ( CurveType == HAPI_CURVETYPE_LINEAR )
+    {
+        // Closed polygon curves are output as a single polygon face.
+        bIsCurve = !bClosed;
+    }
+    else
+    {
+        // Closed NURBS and bezier curves end on their first point.
+        if ( bClosed )
+            PointIndices.Add( 0 );
+
+        Order = HAPI_UNREAL_CURVE_ORDER_DEFAULT;
+        if ( CurveType == HAPI_CURVETYPE_BEZIER )
+        {
+            // Bezier segments need ( Order - 1 ) points, the last point is repeated when points are missing.
+            while ( ( PointIndices.Num() - 1 ) % ( Order - 1 ) != 0 )
+                PointIndices.Add( PointIndices.Last() );
+        }
+        else
+        {
+            Order = FMath::Min( Order, PointIndices.Num() );
+        }
+    }
+
+    const int32 PointCount = PointIndices.Num();
+
+    // The curve is sent through HAPI even when input geometry is encoded: FHoudiniGeoEncoder has no curve
+    // primitives, and a single curve only needs a fixed number of calls, so a buffer would not save round trips.
+    HAPI_PartInfo Part;
+    FMemory::Memzero< HAPI_PartInfo >( Part );
+    Part.id = 0;
+    Part.nameSH = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_POINT ] = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_PRIM ] = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_VERTEX ] = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_DETAIL ] = 0;
+    Part.pointCount = PointCount;
+    Part.vertexCount = PointCount;
+    Part.faceCount = 1;
+    Part.type = bIsCurve ? HAPI_PARTTYPE_CURVE : HAPI_PARTTYPE_MESH;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetPartInfo(
+        FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, &Part ), false );
+
+    if ( bIsCurve )
+    {
+        HAPI_CurveInfo CurveInfo;
+        FMemory::Memzero< HAPI_CurveInfo >( CurveInfo );
+        CurveInfo.curveType = (HAPI_CurveType) CurveType;
+        CurveInfo.curveCount = 1;
+        CurveInfo.vertexCount = PointCount;
+        CurveInfo.isPeriodic = false;
+        CurveInfo.order = Order;
+
+        // NURBS curves are clamped to their end points, with uniform knots in between.
+        TArray< float > Knots;
+        if ( CurveType == HAPI_CURVETYPE_NURBS )
+        {
+            Knots.SetNumUninitialized( PointCount + Order );
+            for ( int32 KnotIdx = 0; KnotIdx < Knots.Num(); ++KnotIdx )
+            {
+                Knots[ KnotIdx ] = FMath::Clamp(
+                    (float) ( KnotIdx - Order + 1 ) / (float) ( PointCount - Order + 1 ), 0.0f, 1.0f );
+            }
+
+            CurveInfo.hasKnots = true;
+            CurveInfo.knotCount = Knots.Num();
+        }
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetCurveInfo(
+            FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, &CurveInfo ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetCurveCounts(
+            FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, &PointCount, 0, 1 ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetCurveOrders(
+            FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, &Order, 0, 1 ), false );
+
+        if ( CurveInfo.hasKnots )
+        {
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetCurveKnots(
+                FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+                Knots.GetData(), 0, Knots.Num() ), false );
+        }
+    }
+    else
+    {
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVertexList(
+            FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+            PointIndices.GetData(), 0, PointCount ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetFaceCounts(
+            FHoudiniEngine::Get().GetSession(), CurveNodeId, 0, &PointCount, 0, 1 ), false );
+    }
+
+    // Get runtime settings.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
+    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
+    if ( HoudiniRuntimeSettings )
+    {
+        GeneratedGeometryScaleFactor = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
+        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
+    }
+
+    const bool bSwapAxis = ( ImportAxis == HRSAI_Unreal );
+
+    HAPI_AttributeInfo AttributeInfo;
+    FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
+    AttributeInfo.count = PointCount;
+    AttributeInfo.exists = true;
+    AttributeInfo.owner = HAPI_ATTROWNER_POINT;
+    AttributeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+    AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+    TArray< float > AttributeValues;
+
+    // Positions.
+    AttributeInfo.tupleSize = 3;
+    AttributeValues.SetNumUninitialized( PointCount * 3 );
+    for ( int32 Idx = 0; Idx < PointCount; ++Idx )
+    {
+        FVector Position = Positions[ PointIndices[ Idx ] ];
+        if ( GeneratedGeometryScaleFactor != 0.0f )
+            Position /= GeneratedGeometryScaleFactor;
+
+        AttributeValues[ Idx * 3 + 0 ] = Position.X;
+        AttributeValues[ Idx * 3 + 1 ] = bSwapAxis ? Position.Z : Position.Y;
+        AttributeValues[ Idx * 3 + 2 ] = bSwapAxis ? Position.Y : Position.Z;
+    }
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+        FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+        HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfo ), false );
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+        FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+        HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfo,
+        AttributeValues.GetData(), 0, PointCount ), false );
+
+    // Rotations.
+    if ( Rotations && Rotations->Num() == Positions.Num() )
+    {
+        AttributeInfo.tupleSize = 4;
+        AttributeValues.SetNumUninitialized( PointCount * 4 );
+        for ( int32 Idx = 0; Idx < PointCount; ++Idx )
+        {
+            const FQuat & Rotation = ( *Rotations )[ PointIndices[ Idx ] ];
+            AttributeValues[ Idx * 4 + 0 ] = Rotation.X;
+            AttributeValues[ Idx * 4 + 1 ] = bSwapAxis ? Rotation.Z : Rotation.Y;
+            AttributeValues[ Idx * 4 + 2 ] = bSwapAxis ? Rotation.Y : Rotation.Z;
+            AttributeValues[ Idx * 4 + 3 ] = bSwapAxis ? -Rotation.W : Rotation.W;
+        }
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+            FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+            HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfo ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+            HAPI_UNREAL_ATTRIB_ROTATION, &AttributeInfo,
+            AttributeValues.GetData(), 0, PointCount ), false );
+    }
+
+    // Scales.
+    if ( Scales3d && Scales3d->Num() == Positions.Num() )
+    {
+        AttributeInfo.tupleSize = 3;
+        AttributeValues.SetNumUninitialized( PointCount * 3 );
+        for ( int32 Idx = 0; Idx < PointCount; ++Idx )
+        {
+            const FVector & Scale = ( *Scales3d )[ PointIndices[ Idx ] ];
+            AttributeValues[ Idx * 3 + 0 ] = Scale.X;
+            AttributeValues[ Idx * 3 + 1 ] = bSwapAxis ? Scale.Z : Scale.Y;
+            AttributeValues[ Idx * 3 + 2 ] = bSwapAxis ? Scale.Y : Scale.Z;
+        }
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+            FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+            HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfo ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+            HAPI_UNREAL_ATTRIB_SCALE, &AttributeInfo,
+            AttributeValues.GetData(), 0, PointCount ), false );
+    }
+
+    // Uniform scales.
+    if ( UniformScales && UniformScales->Num() == Positions.Num() )
+    {
+        AttributeInfo.tupleSize = 1;
+        AttributeValues.SetNumUninitialized( PointCount );
+        for ( int32 Idx = 0; Idx < PointCount; ++Idx )
+            AttributeValues[ Idx ] = ( *UniformScales )[ PointIndices[ Idx ] ];
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+            FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+            HAPI_UNREAL_ATTRIB_UNIFORM_SCALE, &AttributeInfo ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), CurveNodeId, 0,
+            HAPI_UNREAL_ATTRIB_UNIFORM_SCALE, &AttributeInfo,
+            AttributeValues.GetData(), 0, PointCount ), false );
+    }
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
+        FHoudiniEngine::Get().GetSession(), CurveNodeId ), false );
+
+#endif
+
+    return true;
+}
+
 bool
 FHoudiniEngineUtils::HapiGetAssetTransform( HAPI_NodeId AssetId, FTransform & InTransform )
 {
@@ -2407,14 +2761,57 @@ FHoudiniEngineUtils::HapiGetObjectTransforms( HAPI_NodeId AssetId, TArray< HAPI_
     return true;
 }
 
+void
+FHoudiniEngineUtils::GetLandscapeComponentsToExport(
+    ALandscapeProxy * LandscapeProxy, bool bExportOnlySelected,
+    TArray< ULandscapeComponent * > & LandscapeComponents )
+{
+    LandscapeComponents.Empty();
+
+    if ( !LandscapeProxy )
+        return;
+
+#if WITH_EDITOR
+
+    const ULandscapeInfo * LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+
+    TSet< ULandscapeComponent * > SelectedComponents;
+    if ( bExportOnlySelected && LandscapeInfo )
+        SelectedComponents = LandscapeInfo->GetSelectedComponents();
+
+    bExportOnlySelected = bExportOnlySelected && SelectedComponents.Num() > 0;
+
+    for ( ULandscapeComponent * LandscapeComponent : LandscapeProxy->LandscapeComponents )
+    {
+        if ( !LandscapeComponent )
+            continue;
+
+        if ( bExportOnlySelected && !SelectedComponents.Contains( LandscapeComponent ) )
+            continue;
+
+        LandscapeComponents.Add( LandscapeComponent );
+    }
+
+#endif
+}
+
+FIntPoint
+FHoudiniEngineUtils::GetLandscapeComponentsSectionBaseMax( const TArray< ULandscapeComponent * > & LandscapeComponents )
+{
+    FIntPoint IntPointMax = FIntPoint::ZeroValue;
+    for ( const ULandscapeComponent * LandscapeComponent : LandscapeComponents )
+        IntPointMax = IntPointMax.ComponentMax( LandscapeComponent->GetSectionBase() );
+
+    return IntPointMax;
+}
+
 bool
-FHoudiniEngineUtils::HapiCreateInputNodeForData(
-    HAPI_NodeId HostAssetId,
-    ALandscapeProxy * LandscapeProxy, HAPI_NodeId & ConnectedAssetId,
-    bool bExportOnlySelected, bool bExportCurves,
+FHoudiniEngineUtils::HapiCreateInputNodeForLandscapeComponents(
+    HAPI_NodeId HostAssetId, ALandscapeProxy * LandscapeProxy,
+    const TArray< ULandscapeComponent * > & LandscapeComponents, HAPI_NodeId & ConnectedAssetId,
     bool bExportMaterials, bool bExportGeometryAsMesh,
     bool bExportLighting, bool bExportNormalizedUVs,
-    bool bExportTileUVs )
+    bool bExportTileUVs, const FIntPoint & UVNormalizationMax )
 {
 #if WITH_EDITOR
 
@@ -2422,6 +2819,9 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
     if ( !LandscapeProxy || !FHoudiniEngineUtils::IsHoudiniAssetValid( HostAssetId ) )
         return false;
 
+    if ( LandscapeComponents.Num() <= 0 )
+        return false;
+
     // Check if connected asset id is invalid, if it is not, we need to create an input asset.
     if ( ConnectedAssetId < 0 )
     {
@@ -2452,44 +2852,13 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
         ImportAxis = HoudiniRuntimeSettings->ImportAxis;
     }
 
-    const ULandscapeInfo * LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
-
-    TSet< ULandscapeComponent * > SelectedComponents;
-    if ( bExportOnlySelected && LandscapeInfo )
-        SelectedComponents = LandscapeInfo->GetSelectedComponents();
-
-    bExportOnlySelected = bExportOnlySelected && SelectedComponents.Num() > 0;
-
-    int32 MinX = TNumericLimits< int32 >::Max();
-    int32 MinY = TNumericLimits< int32 >::Max();
-    int32 MaxX = TNumericLimits< int32 >::Lowest();
-    int32 MaxY = TNumericLimits< int32 >::Lowest();
-
-    for ( int32 ComponentIdx = 0, ComponentNum = LandscapeProxy->LandscapeComponents.Num();
-        ComponentIdx < ComponentNum; ComponentIdx++ )
-    {
-        ULandscapeComponent * LandscapeComponent = LandscapeProxy->LandscapeComponents[ ComponentIdx ];
-
-        if ( bExportOnlySelected && !SelectedComponents.Contains( LandscapeComponent ) )
-            continue;
-
-        LandscapeComponent->GetComponentExtent( MinX, MinY, MaxX, MaxY );
-    }
-
-    // Landscape actor transform.
-    const FTransform & LandscapeTransform = LandscapeProxy->LandscapeActorToWorld();
-
     // Add Weightmap UVs to match with an exported weightmap, not the original weightmap UVs, which are per-component.
     //const FVector2D UVScale = FVector2D(1.0f, 1.0f) / FVector2D((MaxX - MinX) + 1, (MaxY - MinY) + 1);
 
     int32 ComponentSizeQuads = ( ( LandscapeProxy->ComponentSizeQuads + 1 ) >> LandscapeProxy->ExportLOD ) - 1;
     float ScaleFactor = (float) LandscapeProxy->ComponentSizeQuads / (float) ComponentSizeQuads;
 
-    int32 NumComponents = LandscapeProxy->LandscapeComponents.Num();
-    if(bExportOnlySelected)
-    {
-        NumComponents = SelectedComponents.Num();
-    }
+    int32 NumComponents = LandscapeComponents.Num();
 
     int32 VertexCountPerComponent = FMath::Square( ComponentSizeQuads + 1 );
     int32 VertexCount = NumComponents * VertexCountPerComponent;
@@ -2527,8 +2896,10 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
     HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetDisplayGeoInfo(
         FHoudiniEngine::Get().GetSession(), ConnectedAssetId, &DisplayGeoInfo ), false );
 
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetPartInfo(
-        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0, &Part ), false );
+    // Stage the part, it is either encoded and sent as a single geometry buffer or sent attribute by attribute.
+    FHoudiniGeoEncoder GeoEncoder( DisplayGeoInfo.nodeId, FHoudiniGeoEncoder::IsEncodingEnabled() );
+
+    HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetPartInfo( &Part ), false );
 
     // Extract point data.
     TArray< float > AllPositions;
@@ -2564,176 +2935,188 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
     TArray< const char * > FaceMaterials;
     TArray< const char * > FaceHoleMaterials;
 
-    FIntPoint IntPointMax = FIntPoint::ZeroValue;
-
-    int32 AllPositionsIdx = 0;
-    for ( int32 ComponentIdx = 0, ComponentNum = LandscapeProxy->LandscapeComponents.Num();
-        ComponentIdx < ComponentNum; ComponentIdx++ )
+    // Components are extracted in batches: the data interfaces lock the heightmaps and the lightmaps are copied
+    // on the game thread, then the vertices are computed in parallel, one row of a component per task, so that
+    // a single updated component is spread over all the workers too. Each row has its own slice of the arrays.
+    const int32 ComponentSizeVerts = ComponentSizeQuads + 1;
+    const int32 BatchSize = HAPI_UNREAL_LANDSCAPE_EXPORT_BATCH_SIZE;
+    for ( int32 BatchStart = 0; BatchStart < NumComponents; BatchStart += BatchSize )
     {
-        ULandscapeComponent * LandscapeComponent = LandscapeProxy->LandscapeComponents[ ComponentIdx ];
+        const int32 BatchCount = FMath::Min( BatchSize, NumComponents - BatchStart );
 
-        if ( bExportOnlySelected && !SelectedComponents.Contains( LandscapeComponent ) )
-            continue;
+        TArray< TSharedPtr< FLandscapeComponentDataInterface > > ComponentDataInterfaces;
+        TArray< TArray< uint8 > > LightmapMipDatas;
+        TArray< FIntPoint > LightmapMipSizes;
+        TArray< const char * > ComponentNames;
 
-        TArray< uint8 > LightmapMipData;
-        int32 LightmapMipSizeX = 0;
-        int32 LightmapMipSizeY = 0;
+        ComponentDataInterfaces.SetNum( BatchCount );
+        LightmapMipDatas.SetNum( BatchCount );
+        LightmapMipSizes.Init( FIntPoint::ZeroValue, BatchCount );
+        ComponentNames.SetNumUninitialized( BatchCount );
 
-        // See if we need to export lighting information.
-        if ( bExportLighting )
+        for ( int32 BatchIdx = 0; BatchIdx < BatchCount; BatchIdx++ )
         {
-            const FMeshMapBuildData* MapBuildData = LandscapeComponent->GetMeshMapBuildData();
-            FLightMap2D* LightMap2D = MapBuildData && MapBuildData->LightMap ? MapBuildData->LightMap->GetLightMap2D() : nullptr;
-            if ( LightMap2D )
+            ULandscapeComponent * LandscapeComponent = LandscapeComponents[ BatchStart + BatchIdx ];
+
+            // See if we need to export lighting information.
+            if ( bExportLighting )
             {
-                if ( LightMap2D->IsValid( 0 ) )
+                const FMeshMapBuildData* MapBuildData = LandscapeComponent->GetMeshMapBuildData();
+                FLightMap2D* LightMap2D = MapBuildData && MapBuildData->LightMap ? MapBuildData->LightMap->GetLightMap2D() : nullptr;
+                if ( LightMap2D && LightMap2D->IsValid( 0 ) )
                 {
                     UTexture2D * TextureLightmap = LightMap2D->GetTexture( 0 );
                     if ( TextureLightmap )
                     {
-                        if ( TextureLightmap->Source.GetMipData( LightmapMipData, 0 ) )
+                        if ( TextureLightmap->Source.GetMipData( LightmapMipDatas[ BatchIdx ], 0 ) )
                         {
-                            LightmapMipSizeX = TextureLightmap->Source.GetSizeX();
-                            LightmapMipSizeY = TextureLightmap->Source.GetSizeY();
+                            LightmapMipSizes[ BatchIdx ].X = TextureLightmap->Source.GetSizeX();
+                            LightmapMipSizes[ BatchIdx ].Y = TextureLightmap->Source.GetSizeY();
                         }
                         else
                         {
-                            LightmapMipData.Empty();
+                            LightmapMipDatas[ BatchIdx ].Empty();
                         }
                     }
                 }
             }
-        }
 
-        // Construct landscape component data interface to access raw data.
-        FLandscapeComponentDataInterface CDI( LandscapeComponent, LandscapeProxy->ExportLOD );
+            // Construct landscape component data interface to access raw data.
+            ComponentDataInterfaces[ BatchIdx ] = MakeShareable(
+                new FLandscapeComponentDataInterface( LandscapeComponent, LandscapeProxy->ExportLOD ) );
 
-        // Get name of this landscape component.
-        char * LandscapeComponentNameStr = FHoudiniEngineUtils::ExtractRawName( LandscapeComponent->GetName() );
-        UniqueNames.Add( TSharedPtr< char >( LandscapeComponentNameStr ) );
+            // Get name of this landscape component.
+            char * LandscapeComponentNameStr = FHoudiniEngineUtils::ExtractRawName( LandscapeComponent->GetName() );
+            UniqueNames.Add( TSharedPtr< char >( LandscapeComponentNameStr ) );
+            ComponentNames[ BatchIdx ] = LandscapeComponentNameStr;
+        }
 
-        for ( int32 VertexIdx = 0; VertexIdx < VertexCountPerComponent; VertexIdx++ )
+        ParallelFor( BatchCount * ComponentSizeVerts, [&]( int32 RowTaskIdx )
         {
-            int32 VertX = 0;
-            int32 VertY = 0;
-            CDI.VertexIndexToXY( VertexIdx, VertX, VertY );
+            const int32 BatchIdx = RowTaskIdx / ComponentSizeVerts;
+            const int32 RowIdx = RowTaskIdx % ComponentSizeVerts;
 
-            // Get position.
-            FVector PositionVector = CDI.GetWorldVertex( VertX, VertY );
+            const ULandscapeComponent * LandscapeComponent = LandscapeComponents[ BatchStart + BatchIdx ];
+            FLandscapeComponentDataInterface & CDI = *ComponentDataInterfaces[ BatchIdx ];
+            const TArray< uint8 > & LightmapMipData = LightmapMipDatas[ BatchIdx ];
 
-            // Get normal / tangent / binormal.
-            FVector Normal = FVector::ZeroVector;
-            FVector TangentX = FVector::ZeroVector;
-            FVector TangentY = FVector::ZeroVector;
-            CDI.GetLocalTangentVectors( VertX, VertY, TangentX, TangentY, Normal );
+            // Retrieve component transform and scale.
+            const FTransform & ComponentTransform = LandscapeComponent->ComponentToWorld;
+            const FVector & ScaleVector = ComponentTransform.GetScale3D();
+            const FIntPoint IntPoint = LandscapeComponent->GetSectionBase();
 
-            // Export UVs.
-            FVector TextureUV = FVector::ZeroVector;
+            // This component's slice of the point arrays.
+            const int32 ComponentPointStart = ( BatchStart + BatchIdx ) * VertexCountPerComponent;
 
-            if ( bExportTileUVs )
+            const int32 RowVertexEnd = ( RowIdx + 1 ) * ComponentSizeVerts;
+            for ( int32 VertexIdx = RowIdx * ComponentSizeVerts; VertexIdx < RowVertexEnd; VertexIdx++ )
             {
-                // We want to export uvs per tile.
-                TextureUV = FVector( VertX, VertY, 0.0f );
+                const int32 AllPositionsIdx = ComponentPointStart + VertexIdx;
 
-                // If we need to normalize UV space.
-                if ( bExportNormalizedUVs )
-                    TextureUV /= ComponentSizeQuads;
-            }
-            else
-            {
-                // We want to export global uvs (default).
-                FIntPoint IntPoint = LandscapeComponent->GetSectionBase();
-                TextureUV = FVector( VertX * ScaleFactor + IntPoint.X, VertY * ScaleFactor + IntPoint.Y, 0.0f );
+                int32 VertX = 0;
+                int32 VertY = 0;
+                CDI.VertexIndexToXY( VertexIdx, VertX, VertY );
 
-                // Keep track of max offset.
-                IntPointMax = IntPointMax.ComponentMax( IntPoint );
-            }
+                // Get position.
+                FVector PositionVector = CDI.GetWorldVertex( VertX, VertY );
 
-            if ( bExportLighting )
-            {
-                FLinearColor VertexLightmapColor( 0.0f, 0.0f, 0.0f, 1.0f );
+                // Get normal / tangent / binormal.
+                FVector Normal = FVector::ZeroVector;
+                FVector TangentX = FVector::ZeroVector;
+                FVector TangentY = FVector::ZeroVector;
+                CDI.GetLocalTangentVectors( VertX, VertY, TangentX, TangentY, Normal );
 
-                if ( LightmapMipData.Num() > 0 )
-                {
-                    FVector2D UVCoord( VertX, VertY );
-                    UVCoord /= ( ComponentSizeQuads + 1 );
+                // Export UVs.
+                FVector TextureUV = FVector::ZeroVector;
 
-                    FColor LightmapColorRaw = PickVertexColorFromTextureMip(
-                        LightmapMipData.GetData(), UVCoord, LightmapMipSizeX, LightmapMipSizeY );
+                if ( bExportTileUVs )
+                {
+                    // We want to export uvs per tile.
+                    TextureUV = FVector( VertX, VertY, 0.0f );
 
-                    VertexLightmapColor = LightmapColorRaw.ReinterpretAsLinear();
+                    // If we need to normalize UV space.
+                    if ( bExportNormalizedUVs )
+                        TextureUV /= ComponentSizeQuads;
+                }
+                else
+                {
+                    // We want to export global uvs (default).
+                    TextureUV = FVector( VertX * ScaleFactor + IntPoint.X, VertY * ScaleFactor + IntPoint.Y, 0.0f );
                 }
 
-                LightmapVertexValues[ AllPositionsIdx ] = VertexLightmapColor;
-            }
-
-            // Get Weightmap UV data.
-            //FVector2D WeightmapUV = ( TextureUV - FVector2D( MinX, MinY ) ) * UVScale;
-            //WeightmapUV.Y = 1.0f - WeightmapUV.Y;
+                if ( bExportLighting )
+                {
+                    FLinearColor VertexLightmapColor( 0.0f, 0.0f, 0.0f, 1.0f );
 
-            // Retrieve component transform.
-            const FTransform & ComponentTransform = LandscapeComponent->ComponentToWorld;
+                    if ( LightmapMipData.Num() > 0 )
+                    {
+                        FVector2D UVCoord( VertX, VertY );
+                        UVCoord /= ( ComponentSizeQuads + 1 );
 
-            // Retrieve component scale.
-            const FVector & ScaleVector = ComponentTransform.GetScale3D();
+                        FColor LightmapColorRaw = PickVertexColorFromTextureMip(
+                            LightmapMipData.GetData(), UVCoord,
+                            LightmapMipSizes[ BatchIdx ].X, LightmapMipSizes[ BatchIdx ].Y );
 
-            // Perform normalization.
-            Normal /= ScaleVector;
-            Normal.Normalize();
+                        VertexLightmapColor = LightmapColorRaw.ReinterpretAsLinear();
+                    }
 
-            TangentX /= ScaleVector;
-            TangentX.Normalize();
+                    LightmapVertexValues[ AllPositionsIdx ] = VertexLightmapColor;
+                }
 
-            TangentY /= ScaleVector;
-            TangentY.Normalize();
+                // Perform normalization.
+                Normal /= ScaleVector;
+                Normal.Normalize();
 
-            // Peform position scaling.
-            FVector PositionTransformed = PositionVector / GeneratedGeometryScaleFactor;
+                TangentX /= ScaleVector;
+                TangentX.Normalize();
 
-            if ( ImportAxis == HRSAI_Unreal )
-            {
-                AllPositions[ AllPositionsIdx * 3 + 0 ] = PositionTransformed.X;
-                AllPositions[ AllPositionsIdx * 3 + 1 ] = PositionTransformed.Z;
-                AllPositions[ AllPositionsIdx * 3 + 2 ] = PositionTransformed.Y;
+                TangentY /= ScaleVector;
+                TangentY.Normalize();
 
-                Swap( Normal.Y, Normal.Z );
-            }
-            else if ( ImportAxis == HRSAI_Houdini )
-            {
-                AllPositions[ AllPositionsIdx * 3 + 0 ] = PositionTransformed.X;
-                AllPositions[ AllPositionsIdx * 3 + 1 ] = PositionTransformed.Y;
-                AllPositions[ AllPositionsIdx * 3 + 2 ] = PositionTransformed.Z;
-            }
-            else
-            {
-                // Not a valid enum value.
-                check( 0 );
-            }
+                // Peform position scaling.
+                FVector PositionTransformed = PositionVector / GeneratedGeometryScaleFactor;
 
-            // Store landscape component name for this point.
-            PositionTileNames[ AllPositionsIdx ] = LandscapeComponentNameStr;
+                if ( ImportAxis == HRSAI_Unreal )
+                {
+                    AllPositions[ AllPositionsIdx * 3 + 0 ] = PositionTransformed.X;
+                    AllPositions[ AllPositionsIdx * 3 + 1 ] = PositionTransformed.Z;
+                    AllPositions[ AllPositionsIdx * 3 + 2 ] = PositionTransformed.Y;
 
-            // Store vertex index (x,y) for this point.
-            PositionComponentVertexIndices[ AllPositionsIdx * 2 + 0 ] = VertX;
-            PositionComponentVertexIndices[ AllPositionsIdx * 2 + 1 ] = VertY;
+                    Swap( Normal.Y, Normal.Z );
+                }
+                else if ( ImportAxis == HRSAI_Houdini )
+                {
+                    AllPositions[ AllPositionsIdx * 3 + 0 ] = PositionTransformed.X;
+                    AllPositions[ AllPositionsIdx * 3 + 1 ] = PositionTransformed.Y;
+                    AllPositions[ AllPositionsIdx * 3 + 2 ] = PositionTransformed.Z;
+                }
+                else
+                {
+                    // Not a valid enum value.
+                    check( 0 );
+                }
 
-            // Store point normal.
-            PositionNormals[ AllPositionsIdx ] = Normal;
+                // Store landscape component name for this point.
+                PositionTileNames[ AllPositionsIdx ] = ComponentNames[ BatchIdx ];
 
-            // Store uv.
-            PositionUVs[ AllPositionsIdx ] = TextureUV;
+                // Store vertex index (x,y) for this point.
+                PositionComponentVertexIndices[ AllPositionsIdx * 2 + 0 ] = VertX;
+                PositionComponentVertexIndices[ AllPositionsIdx * 2 + 1 ] = VertY;
 
-            // Store weightmap uv.
-            //PositionWeightmapUVs[ AllPositionsIdx ] = WeightmapUV;
+                // Store point normal.
+                PositionNormals[ AllPositionsIdx ] = Normal;
 
-            AllPositionsIdx++;
-        }
+                // Store uv.
+                PositionUVs[ AllPositionsIdx ] = TextureUV;
+            }
+        } );
     }
 
     // If we need to normalize UV space and we are doing global UVs.
     if ( !bExportTileUVs && bExportNormalizedUVs )
     {
-        IntPointMax += FIntPoint( ComponentSizeQuads, ComponentSizeQuads );
+        // The max offset is given by the caller, so that components uploaded separately share the same UV space.
+        FIntPoint IntPointMax = UVNormalizationMax + FIntPoint( ComponentSizeQuads, ComponentSizeQuads );
         IntPointMax = IntPointMax.ComponentMax( FIntPoint( 1, 1 ) );
 
         for ( int32 UVIdx = 0; UVIdx < VertexCount; ++UVIdx )
@@ -2757,14 +3140,10 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
 
         bool bFailedAttribute = true;
 
-        if ( FHoudiniApi::AddAttribute(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAME,
+        if ( GeoEncoder.AddAttribute( HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAME,
             &AttributeInfoPointLandscapeComponentNames ) == HAPI_RESULT_SUCCESS )
         {
-            if ( FHoudiniApi::SetAttributeStringData(
-                FHoudiniEngine::Get().GetSession(),
-                DisplayGeoInfo.nodeId, 0, HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAME,
+            if ( GeoEncoder.SetAttributeStringData( HAPI_UNREAL_ATTRIB_LANDSCAPE_TILE_NAME,
                 &AttributeInfoPointLandscapeComponentNames,
                 (const char **) PositionTileNames.GetData(), 0,
                 AttributeInfoPointLandscapeComponentNames.count ) == HAPI_RESULT_SUCCESS )
@@ -2791,13 +3170,9 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
         AttributeInfoPointPosition.storage = HAPI_STORAGETYPE_FLOAT;
         AttributeInfoPointPosition.originalOwner = HAPI_ATTROWNER_INVALID;
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPointPosition ), false );
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPointPosition ), false );
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-            FHoudiniEngine::Get().GetSession(),
-            DisplayGeoInfo.nodeId, 0, HAPI_UNREAL_ATTRIB_POSITION,
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeFloatData( HAPI_UNREAL_ATTRIB_POSITION,
             &AttributeInfoPointPosition, AllPositions.GetData(),
             0, AttributeInfoPointPosition.count ), false );
     }
@@ -2813,13 +3188,9 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
         AttributeInfoPointNormal.storage = HAPI_STORAGETYPE_FLOAT;
         AttributeInfoPointNormal.originalOwner = HAPI_ATTROWNER_INVALID;
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoPointNormal ), false );
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoPointNormal ), false );
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-            FHoudiniEngine::Get().GetSession(),
-            DisplayGeoInfo.nodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoPointNormal,
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeFloatData( HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoPointNormal,
             (const float *) PositionNormals.GetData(), 0, AttributeInfoPointNormal.count ), false );
     }
 
@@ -2834,14 +3205,10 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
         AttributeInfoPointLandscapeComponentVertexIndices.storage = HAPI_STORAGETYPE_INT;
         AttributeInfoPointLandscapeComponentVertexIndices.originalOwner = HAPI_ATTROWNER_INVALID;
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, HAPI_UNREAL_ATTRIB_LANDSCAPE_VERTEX_INDEX,
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( HAPI_UNREAL_ATTRIB_LANDSCAPE_VERTEX_INDEX,
             &AttributeInfoPointLandscapeComponentVertexIndices ), false );
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeIntData(
-            FHoudiniEngine::Get().GetSession(),
-            DisplayGeoInfo.nodeId, 0, HAPI_UNREAL_ATTRIB_LANDSCAPE_VERTEX_INDEX,
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeIntData( HAPI_UNREAL_ATTRIB_LANDSCAPE_VERTEX_INDEX,
             &AttributeInfoPointLandscapeComponentVertexIndices,
             PositionComponentVertexIndices.GetData(), 0,
             AttributeInfoPointLandscapeComponentVertexIndices.count ), false );
@@ -2858,13 +3225,9 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
         AttributeInfoPointUV.storage = HAPI_STORAGETYPE_FLOAT;
         AttributeInfoPointUV.originalOwner = HAPI_ATTROWNER_INVALID;
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, HAPI_UNREAL_ATTRIB_UV, &AttributeInfoPointUV ), false );
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( HAPI_UNREAL_ATTRIB_UV, &AttributeInfoPointUV ), false );
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-            FHoudiniEngine::Get().GetSession(),
-            DisplayGeoInfo.nodeId, 0, HAPI_UNREAL_ATTRIB_UV, &AttributeInfoPointUV,
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeFloatData( HAPI_UNREAL_ATTRIB_UV, &AttributeInfoPointUV,
             (const float *) PositionUVs.GetData(), 0, AttributeInfoPointUV.count ), false );
     }
 
@@ -2880,13 +3243,9 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
         AttributeInfoPointLightmapColor.storage = HAPI_STORAGETYPE_FLOAT;
         AttributeInfoPointLightmapColor.originalOwner = HAPI_ATTROWNER_INVALID;
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, HAPI_UNREAL_ATTRIB_LIGHTMAP_COLOR, &AttributeInfoPointLightmapColor ), false );
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( HAPI_UNREAL_ATTRIB_LIGHTMAP_COLOR, &AttributeInfoPointLightmapColor ), false );
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-            FHoudiniEngine::Get().GetSession(),
-            DisplayGeoInfo.nodeId, 0, HAPI_UNREAL_ATTRIB_LIGHTMAP_COLOR, &AttributeInfoPointLightmapColor,
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeFloatData( HAPI_UNREAL_ATTRIB_LIGHTMAP_COLOR, &AttributeInfoPointLightmapColor,
             (const float *) LightmapVertexValues.GetData(), 0,
             AttributeInfoPointLightmapColor.count ), false );
     }
@@ -2903,13 +3262,9 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
         AttributeInfoPointWeightmapUV.storage = HAPI_STORAGETYPE_FLOAT;
         AttributeInfoPointWeightmapUV.originalOwner = HAPI_ATTROWNER_INVALID;
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, HAPI_UNREAL_ATTRIB_UV_WEIGHTMAP, &AttributeInfoPointWeightmapUV ), false );
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( HAPI_UNREAL_ATTRIB_UV_WEIGHTMAP, &AttributeInfoPointWeightmapUV ), false );
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-            FHoudiniEngine::Get().GetSession(),
-            DisplayGeoInfo.nodeId, 0, HAPI_UNREAL_ATTRIB_UV_WEIGHTMAP, &AttributeInfoPointWeightmapUV,
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeFloatData( HAPI_UNREAL_ATTRIB_UV_WEIGHTMAP, &AttributeInfoPointWeightmapUV,
             (const float*) PositionWeightmapUVs.GetData(), 0,
             AttributeInfoPointWeightmapUV.count ), false );
     }
@@ -2926,82 +3281,92 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
         FaceMaterials.SetNumUninitialized( QuadCount );
         FaceHoleMaterials.SetNumUninitialized( QuadCount );
 
-        int32 VertIdx = 0;
-        int32 QuadIdx = 0;
-
         char * MaterialRawStr = nullptr;
         char * MaterialHoleRawStr = nullptr;
 
-        const int32 QuadComponentCount = ComponentSizeQuads + 1;
-        for ( int32 ComponentIdx = 0; ComponentIdx < NumComponents; ComponentIdx++ )
+        // Raw names are allocated on this thread, the faces then only reference them.
+        TArray< const char * > ComponentMaterials;
+        TArray< const char * > ComponentHoleMaterials;
+        ComponentMaterials.SetNumZeroed( NumComponents );
+        ComponentHoleMaterials.SetNumZeroed( NumComponents );
+
+        for ( int32 ComponentIdx = 0; bExportMaterials && ComponentIdx < NumComponents; ComponentIdx++ )
         {
-            ULandscapeComponent * LandscapeComponent = LandscapeProxy->LandscapeComponents[ ComponentIdx ];
+            ULandscapeComponent * LandscapeComponent = LandscapeComponents[ ComponentIdx ];
 
-            // If component has an override material, we need to get the raw name (if exporting materials).
-            if ( bExportMaterials && LandscapeComponent->OverrideMaterial )
+            // If component has an override material, we need to get the raw name.
+            if ( LandscapeComponent->OverrideMaterial )
             {
                 MaterialRawStr = FHoudiniEngineUtils::ExtractRawName( LandscapeComponent->OverrideMaterial->GetName() );
                 UniqueNames.Add( TSharedPtr< char >( MaterialRawStr ) );
             }
 
-            // If component has an override hole material, we need to get the raw name (if exporting materials).
-            if ( bExportMaterials && LandscapeComponent->OverrideHoleMaterial )
+            // If component has an override hole material, we need to get the raw name.
+            if ( LandscapeComponent->OverrideHoleMaterial )
             {
                 MaterialHoleRawStr = FHoudiniEngineUtils::ExtractRawName(
                     LandscapeComponent->OverrideHoleMaterial->GetName() );
                 UniqueNames.Add( TSharedPtr< char >( MaterialHoleRawStr ) );
             }
 
-            int32 BaseVertIndex = ComponentIdx * VertexCountPerComponent;
-            for ( int32 YIdx = 0; YIdx < ComponentSizeQuads; YIdx++ )
+            ComponentMaterials[ ComponentIdx ] = MaterialRawStr;
+            ComponentHoleMaterials[ ComponentIdx ] = MaterialHoleRawStr;
+        }
+
+        // Each row of quads of a component writes to its own slice of the index and face arrays.
+        const int32 QuadComponentCount = ComponentSizeQuads + 1;
+        const int32 QuadCountPerComponent = FMath::Square( ComponentSizeQuads );
+        ParallelFor( NumComponents * ComponentSizeQuads, [&]( int32 RowTaskIdx )
+        {
+            const int32 ComponentIdx = RowTaskIdx / ComponentSizeQuads;
+            const int32 YIdx = RowTaskIdx % ComponentSizeQuads;
+
+            int32 QuadIdx = ComponentIdx * QuadCountPerComponent + YIdx * ComponentSizeQuads;
+            int32 VertIdx = QuadIdx * 4;
+
+            const int32 BaseVertIndex = ComponentIdx * VertexCountPerComponent;
+            for ( int32 XIdx = 0; XIdx < ComponentSizeQuads; XIdx++ )
             {
-                for ( int32 XIdx = 0; XIdx < ComponentSizeQuads; XIdx++ )
+                if ( ImportAxis == HRSAI_Unreal )
                 {
-                    if ( ImportAxis == HRSAI_Unreal )
-                    {
-                        LandscapeIndices[ VertIdx + 0 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 0 ) * QuadComponentCount;
-                        LandscapeIndices[ VertIdx + 1 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 0 ) * QuadComponentCount;
-                        LandscapeIndices[ VertIdx + 2 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 1 ) * QuadComponentCount;
-                        LandscapeIndices[ VertIdx + 3 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 1 ) * QuadComponentCount;
-                    }
-                    else if ( ImportAxis == HRSAI_Houdini )
-                    {
-                        LandscapeIndices[ VertIdx + 0 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 0 ) * QuadComponentCount;
-                        LandscapeIndices[ VertIdx + 1 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 1 ) * QuadComponentCount;
-                        LandscapeIndices[ VertIdx + 2 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 1 ) * QuadComponentCount;
-                        LandscapeIndices[ VertIdx + 3 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 0 ) * QuadComponentCount;
-                    }
-                    else
-                    {
-                        // Not a valid enum value.
-                        check( 0 );
-                    }
-
-                    // Store override materials (if exporting materials).
-                    if ( bExportMaterials )
-                    {
-                        FaceMaterials[ QuadIdx ] = MaterialRawStr;
-                        FaceHoleMaterials[ QuadIdx ] = MaterialHoleRawStr;
-                    }
+                    LandscapeIndices[ VertIdx + 0 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 0 ) * QuadComponentCount;
+                    LandscapeIndices[ VertIdx + 1 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 0 ) * QuadComponentCount;
+                    LandscapeIndices[ VertIdx + 2 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 1 ) * QuadComponentCount;
+                    LandscapeIndices[ VertIdx + 3 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 1 ) * QuadComponentCount;
+                }
+                else if ( ImportAxis == HRSAI_Houdini )
+                {
+                    LandscapeIndices[ VertIdx + 0 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 0 ) * QuadComponentCount;
+                    LandscapeIndices[ VertIdx + 1 ] = BaseVertIndex + ( XIdx + 0 ) + ( YIdx + 1 ) * QuadComponentCount;
+                    LandscapeIndices[ VertIdx + 2 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 1 ) * QuadComponentCount;
+                    LandscapeIndices[ VertIdx + 3 ] = BaseVertIndex + ( XIdx + 1 ) + ( YIdx + 0 ) * QuadComponentCount;
+                }
+                else
+                {
+                    // Not a valid enum value.
+                    check( 0 );
+                }
 
-                    VertIdx += 4;
-                    QuadIdx++;
+                // Store override materials (if exporting materials).
+                if ( bExportMaterials )
+                {
+                    FaceMaterials[ QuadIdx ] = ComponentMaterials[ ComponentIdx ];
+                    FaceHoleMaterials[ QuadIdx ] = ComponentHoleMaterials[ ComponentIdx ];
                 }
+
+                VertIdx += 4;
+                QuadIdx++;
             }
-        }
+        } );
 
         // We can now set vertex list.
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVertexList(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, LandscapeIndices.GetData(), 0, LandscapeIndices.Num() ), false );
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetVertexList( LandscapeIndices.GetData(), 0, LandscapeIndices.Num() ), false );
 
         // We need to generate array of face counts.
         TArray< int32 > LandscapeFaces;
         LandscapeFaces.Init( 4, QuadCount );
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetFaceCounts(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, LandscapeFaces.GetData(), 0, LandscapeFaces.Num() ), false );
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetFaceCounts( LandscapeFaces.GetData(), 0, LandscapeFaces.Num() ), false );
     }
 
     // If we are marshalling material information.
@@ -3037,13 +3402,9 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
             AttributeInfoPrimitiveMaterial.storage = HAPI_STORAGETYPE_STRING;
             AttributeInfoPrimitiveMaterial.originalOwner = HAPI_ATTROWNER_INVALID;
 
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-                FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
-                MarshallingAttributeMaterialName.c_str(), &AttributeInfoPrimitiveMaterial ), false );
+            HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( MarshallingAttributeMaterialName.c_str(), &AttributeInfoPrimitiveMaterial ), false );
 
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeStringData(
-                FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
-                MarshallingAttributeMaterialName.c_str(), &AttributeInfoPrimitiveMaterial,
+            HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeStringData( MarshallingAttributeMaterialName.c_str(), &AttributeInfoPrimitiveMaterial,
                 (const char **) FaceMaterials.GetData(), 0, AttributeInfoPrimitiveMaterial.count ), false );
         }
 
@@ -3059,14 +3420,10 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
             AttributeInfoPrimitiveMaterialHole.storage = HAPI_STORAGETYPE_STRING;
             AttributeInfoPrimitiveMaterialHole.originalOwner = HAPI_ATTROWNER_INVALID;
 
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-                FHoudiniEngine::Get().GetSession(),
-                DisplayGeoInfo.nodeId, 0, MarshallingAttributeMaterialHoleName.c_str(),
+            HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( MarshallingAttributeMaterialHoleName.c_str(),
                 &AttributeInfoPrimitiveMaterialHole ), false );
 
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeStringData(
-                FHoudiniEngine::Get().GetSession(),
-                DisplayGeoInfo.nodeId, 0, MarshallingAttributeMaterialHoleName.c_str(),
+            HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeStringData( MarshallingAttributeMaterialHoleName.c_str(),
                 &AttributeInfoPrimitiveMaterialHole, (const char **) FaceHoleMaterials.GetData(), 0,
                 AttributeInfoPrimitiveMaterialHole.count ), false );
         }
@@ -3090,13 +3447,9 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
             AttributeInfoDetailMaterial.storage = HAPI_STORAGETYPE_STRING;
             AttributeInfoDetailMaterial.originalOwner = HAPI_ATTROWNER_INVALID;
 
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-                FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
-                MarshallingAttributeMaterialName.c_str(), &AttributeInfoDetailMaterial ), false );
+            HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( MarshallingAttributeMaterialName.c_str(), &AttributeInfoDetailMaterial ), false );
 
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeStringData(
-                FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
-                MarshallingAttributeMaterialName.c_str(), &AttributeInfoDetailMaterial,
+            HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeStringData( MarshallingAttributeMaterialName.c_str(), &AttributeInfoDetailMaterial,
                 (const char**) &MaterialNameStr, 0, AttributeInfoDetailMaterial.count ), false );
         }
 
@@ -3119,22 +3472,17 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
             AttributeInfoDetailMaterialHole.storage = HAPI_STORAGETYPE_STRING;
             AttributeInfoDetailMaterialHole.originalOwner = HAPI_ATTROWNER_INVALID;
 
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-                FHoudiniEngine::Get().GetSession(),
-                DisplayGeoInfo.nodeId, 0, MarshallingAttributeMaterialHoleName.c_str(),
+            HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( MarshallingAttributeMaterialHoleName.c_str(),
                 &AttributeInfoDetailMaterialHole ), false );
 
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeStringData(
-                FHoudiniEngine::Get().GetSession(),
-                DisplayGeoInfo.nodeId, 0, MarshallingAttributeMaterialHoleName.c_str(),
+            HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeStringData( MarshallingAttributeMaterialHoleName.c_str(),
                 &AttributeInfoDetailMaterialHole, (const char **) &MaterialNameStr, 0,
                 AttributeInfoDetailMaterialHole.count ), false );
         }
     }
 
     // Commit the geo.
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
-        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId ), false );
+    HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.CommitGeo(), false );
 
 #endif
 
@@ -3143,595 +3491,1554 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
 
 
 bool
-FHoudiniEngineUtils::HapiCreateInputNodeForData(
-    HAPI_NodeId HostAssetId, 
-    USplineComponent * SplineComponent,
-    HAPI_NodeId & ConnectedAssetId,
-    FHoudiniAssetInputOutlinerMesh& OutlinerMesh,
-    const float& SplineResolution)
+FHoudiniEngineUtils::HapiUpdateInputNodeForLandscapeComponents(
+    HAPI_NodeId HostAssetId, ALandscapeProxy * LandscapeProxy, HAPI_NodeId & ConnectedAssetId,
+    TArray< TWeakObjectPtr< ULandscapeComponent > > & UploadedComponents,
+    TArray< HAPI_NodeId > & UploadedComponentNodeIds, TArray< uint32 > & UploadedComponentHashes,
+    bool bExportOnlySelected, bool bExportMaterials, bool bExportGeometryAsMesh,
+    bool bExportLighting, bool bExportNormalizedUVs, bool bExportTileUVs )
 {
 #if WITH_EDITOR
 
-    // If we don't have a spline component, or host asset is invalid, there's nothing to do.
-    if (!SplineComponent || !FHoudiniEngineUtils::IsHoudiniAssetValid(HostAssetId))
+    // If we don't have any landscapes or host asset is invalid then there's nothing to do.
+    if ( !LandscapeProxy || !FHoudiniEngineUtils::IsHoudiniAssetValid( HostAssetId ) )
         return false;
-        
-    float fSplineResolution = SplineResolution;
-    if (fSplineResolution == -1.0f)
+
+    TArray< ULandscapeComponent * > LandscapeComponents;
+    FHoudiniEngineUtils::GetLandscapeComponentsToExport( LandscapeProxy, bExportOnlySelected, LandscapeComponents );
+
+    const int32 NumComponents = LandscapeComponents.Num();
+    if ( NumComponents <= 0 )
+        return false;
+
+    // Global normalized UVs depend on all the exported components, so changing them dirties every component.
+    const FIntPoint UVNormalizationMax = FHoudiniEngineUtils::GetLandscapeComponentsSectionBaseMax( LandscapeComponents );
+    const bool bHashUVNormalization = bExportNormalizedUVs && !bExportTileUVs;
+
+    // Create the merge SOP the first time, each component is then uploaded to its own input node.
+    bool bCreatedMergeNode = false;
+    if ( !FHoudiniEngineUtils::IsHoudiniAssetValid( ConnectedAssetId ) )
     {
-        // Get runtime settings and extract the spline resolution from it
-        const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-        if (HoudiniRuntimeSettings)
-            fSplineResolution = HoudiniRuntimeSettings->MarshallingSplineResolution;
-        else
-            fSplineResolution = HAPI_UNREAL_PARAM_SPLINE_RESOLUTION_DEFAULT;
+        UploadedComponents.Empty();
+        UploadedComponentNodeIds.Empty();
+        UploadedComponentHashes.Empty();
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
+            FHoudiniEngine::Get().GetSession(), -1,
+            "SOP/merge", nullptr, true, &ConnectedAssetId ), false );
+
+        bCreatedMergeNode = true;
     }
 
-    int32 nNumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
-    float fSplineLength = SplineComponent->GetSplineLength();  
+    // The new state is built locally, and only committed once the merge node is wired to it.
+    // Input nodes still in StaleNodeIds afterwards belong to components that are not exported anymore.
+    TArray< HAPI_NodeId > StaleNodeIds = UploadedComponentNodeIds;
 
-    // Calculate the number of refined point we want
-    int32 nNumberOfRefinedSplinePoints = fSplineResolution > 0.0f ? ceil(fSplineLength / fSplineResolution) + 1 : nNumberOfControlPoints;
-    
-    // Array that will store the attributes we want to add to the curves
-    TArray<FVector> tRefinedSplinePositions;
-    TArray<FQuat> tRefinedSplineRotations;    
-    // Scale on Unreal's spline will require some tweaking, as the XScale is always 1
-    TArray<FVector> tRefinedSplineScales;
-    //TArray<float> tRefinedSplinePScales;
+    TArray< HAPI_NodeId > ComponentNodeIds;
+    ComponentNodeIds.Init( -1, NumComponents );
 
-    if ( (nNumberOfRefinedSplinePoints < nNumberOfControlPoints) || (fSplineResolution <= 0.0f) )
+    TArray< bool > ComponentNodeCreated;
+    ComponentNodeCreated.Init( false, NumComponents );
+
+    TArray< uint32 > ComponentHashes;
+    ComponentHashes.SetNumUninitialized( NumComponents );
+
+    int32 UploadedCount = 0;
+    bool bSuccess = true;
+    for ( int32 ComponentIdx = 0; ComponentIdx < NumComponents; ComponentIdx++ )
     {
-        // There's not enough refined points, so we'll use the Spline CVs instead
-        tRefinedSplinePositions.SetNumZeroed(nNumberOfControlPoints);
-        tRefinedSplineRotations.SetNumZeroed(nNumberOfControlPoints);
-        tRefinedSplineScales.SetNumZeroed(nNumberOfControlPoints);
-        //tRefinedSplinePScales.SetNumZeroed(nNumberOfControlPoints);
+        ULandscapeComponent * LandscapeComponent = LandscapeComponents[ ComponentIdx ];
 
-        FVector Scale;
-        for (int32 n = 0; n < nNumberOfControlPoints; n++)
+        uint32 ComponentHash = FHoudiniLandscapeUtils::GetLandscapeComponentHash( LandscapeComponent, bExportLighting );
+        if ( bHashUVNormalization )
+            ComponentHash = HashCombine( ComponentHash, GetTypeHash( UVNormalizationMax ) );
+
+        ComponentHashes[ ComponentIdx ] = ComponentHash;
+
+        // Reuse the component's input node if it has already been uploaded, and skip it if its content didn't change.
+        int32 PreviousIdx = UploadedComponents.IndexOfByPredicate(
+            [ LandscapeComponent ]( const TWeakObjectPtr< ULandscapeComponent > & UploadedComponent )
+            {
+                return UploadedComponent.Get() == LandscapeComponent;
+            } );
+
+        if ( PreviousIdx != INDEX_NONE && StaleNodeIds.IsValidIndex( PreviousIdx ) )
         {
-            tRefinedSplinePositions[n] = SplineComponent->GetLocationAtSplinePoint(n, ESplineCoordinateSpace::Local);
-            tRefinedSplineRotations[n] = SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World);
+            ComponentNodeIds[ ComponentIdx ] = StaleNodeIds[ PreviousIdx ];
+            StaleNodeIds[ PreviousIdx ] = -1;
 
-            Scale = SplineComponent->GetScaleAtSplinePoint(n);
-            tRefinedSplineScales[n] = Scale;
-            // tRefinedSplinePScales[n] = (Scale.Y + Scale.Z) / 2.0f; //FMath::Max(Scale.Y, Scale.Z);
-        }           
+            if ( UploadedComponentHashes.IsValidIndex( PreviousIdx ) && UploadedComponentHashes[ PreviousIdx ] == ComponentHash )
+                continue;
+        }
+
+        ComponentNodeCreated[ ComponentIdx ] = ComponentNodeIds[ ComponentIdx ] < 0;
+
+        TArray< ULandscapeComponent * > DirtyComponent;
+        DirtyComponent.Add( LandscapeComponent );
+
+        if ( !FHoudiniEngineUtils::HapiCreateInputNodeForLandscapeComponents(
+            HostAssetId, LandscapeProxy, DirtyComponent, ComponentNodeIds[ ComponentIdx ],
+            bExportMaterials, bExportGeometryAsMesh, bExportLighting, bExportNormalizedUVs, bExportTileUVs,
+            UVNormalizationMax ) )
+        {
+            bSuccess = false;
+            break;
+        }
+
+        UploadedCount++;
     }
-    else
+
+    // Only rewire the merge node when the list of input nodes changed.
+    bool bRewired = false;
+    if ( bSuccess && ComponentNodeIds != UploadedComponentNodeIds )
     {
-        // Calculating the refined spline points
-        tRefinedSplinePositions.SetNumZeroed(nNumberOfRefinedSplinePoints);
-        tRefinedSplineRotations.SetNumZeroed(nNumberOfRefinedSplinePoints);
-        tRefinedSplineScales.SetNumZeroed(nNumberOfRefinedSplinePoints);
-        // tRefinedSplinePScales.SetNumZeroed(nNumberOfRefinedSplinePoints);
-        
-        FVector Scale;
-        float fCurrentDistance = 0.0f;
-        for (int32 n = 0; n < nNumberOfRefinedSplinePoints; n++)
-        {    
-            tRefinedSplinePositions[n] = SplineComponent->GetLocationAtDistanceAlongSpline(fCurrentDistance, ESplineCoordinateSpace::Local);
-            tRefinedSplineRotations[n] = SplineComponent->GetQuaternionAtDistanceAlongSpline(fCurrentDistance, ESplineCoordinateSpace::World);
-            
-            Scale = SplineComponent->GetScaleAtDistanceAlongSpline(fCurrentDistance);
+        bRewired = true;
+        for ( int32 ComponentIdx = 0; bSuccess && ComponentIdx < NumComponents; ComponentIdx++ )
+        {
+            bSuccess = HAPI_RESULT_SUCCESS == FHoudiniApi::ConnectNodeInput(
+                FHoudiniEngine::Get().GetSession(), ConnectedAssetId, ComponentIdx,
+                ComponentNodeIds[ ComponentIdx ] );
+        }
+    }
 
-            tRefinedSplineScales[n] = Scale;
-            // tRefinedSplinePScales[n] = (Scale.Y + Scale.Z) / 2.0f; //FMath::Max(Scale.Y, Scale.Z);
+    if ( !bSuccess )
+    {
+        HOUDINI_LOG_WARNING( TEXT( "Error uploading landscape input %s." ), *LandscapeProxy->GetName() );
 
-            fCurrentDistance += fSplineResolution;
+        // Destroy the input nodes created by this update, the previous upload is left untouched.
+        // Reused nodes keep their previous hash, and will be uploaded again by the next update.
+        for ( int32 ComponentIdx = 0; ComponentIdx < NumComponents; ComponentIdx++ )
+        {
+            if ( ComponentNodeCreated[ ComponentIdx ] && ComponentNodeIds[ ComponentIdx ] >= 0 )
+                FHoudiniEngineUtils::DestroyHoudiniAsset( ComponentNodeIds[ ComponentIdx ] );
         }
-    }
 
-    if ( !HapiCreateCurveInputNodeForData(
-            HostAssetId, 
-            ConnectedAssetId,
-            &tRefinedSplinePositions,
-            &tRefinedSplineRotations,
-            &tRefinedSplineScales,
-            nullptr) )//&tRefinedSplinePScales) )
-        return false;
+        if ( bCreatedMergeNode )
+        {
+            FHoudiniEngineUtils::DestroyHoudiniAsset( ConnectedAssetId );
+            ConnectedAssetId = -1;
+        }
+        else if ( bRewired )
+        {
+            for ( int32 InputIdx = 0; InputIdx < UploadedComponentNodeIds.Num(); InputIdx++ )
+            {
+                FHoudiniApi::ConnectNodeInput(
+                    FHoudiniEngine::Get().GetSession(), ConnectedAssetId, InputIdx,
+                    UploadedComponentNodeIds[ InputIdx ] );
+            }
+        }
 
-    // Updating the OutlinerMesh's struct infos
-    OutlinerMesh.SplineResolution = fSplineResolution;
-    OutlinerMesh.SplineLength = fSplineLength;
-    OutlinerMesh.NumberOfSplineControlPoints = nNumberOfControlPoints;
+        return false;
+    }
 
-    // We also need to extract all the CV's Transform to check for modifications
-    OutlinerMesh.SplineControlPointsTransform.SetNum(nNumberOfControlPoints);
-    for ( int32 n = 0; n < nNumberOfControlPoints; n++ )
+    if ( bRewired )
     {
-        // Getting the Local Transform for positions and scale
-        OutlinerMesh.SplineControlPointsTransform[n] = SplineComponent->GetTransformAtSplinePoint(n, ESplineCoordinateSpace::Local, true);
+        for ( int32 InputIdx = NumComponents; InputIdx < UploadedComponentNodeIds.Num(); InputIdx++ )
+        {
+            FHoudiniApi::DisconnectNodeInput(
+                FHoudiniEngine::Get().GetSession(), ConnectedAssetId, InputIdx );
+        }
+    }
 
-        // ... but we used we used the world rotation
-        OutlinerMesh.SplineControlPointsTransform[n].SetRotation(SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World));
+    // Destroy the input nodes of the components that are not exported anymore.
+    for ( HAPI_NodeId NodeId : StaleNodeIds )
+    {
+        if ( NodeId >= 0 )
+            FHoudiniEngineUtils::DestroyHoudiniAsset( NodeId );
     }
 
-    // Cook the spline node.
-    FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), ConnectedAssetId, nullptr);
+    UploadedComponents.SetNum( NumComponents );
+    for ( int32 ComponentIdx = 0; ComponentIdx < NumComponents; ComponentIdx++ )
+        UploadedComponents[ ComponentIdx ] = LandscapeComponents[ ComponentIdx ];
+
+    UploadedComponentNodeIds = ComponentNodeIds;
+    UploadedComponentHashes = ComponentHashes;
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Landscape input %s: uploaded %d of %d components." ),
+        *LandscapeProxy->GetName(), UploadedCount, NumComponents );
 
 #endif
 
     return true;
 }
 
+void
+FHoudiniEngineUtils::ConvertLandscapeDataToHeightfieldData(
+    int32 XSize, int32 YSize, TFunctionRef< float( int32 LandscapeIdx ) > GetValue,
+    TArray< float > & HeightfieldValues )
+{
+    // The unreal vertex ( nX, nY ) is the voxel ( nY, nX ) of a heightfield of size ( YSize, XSize ).
+    HeightfieldValues.SetNumUninitialized( XSize * YSize );
+    ParallelFor( YSize, [&]( int32 nY )
+    {
+        for ( int32 nX = 0; nX < XSize; nX++ )
+            HeightfieldValues[ nY + nX * YSize ] = GetValue( nX + nY * XSize );
+    } );
+}
+
 bool
-FHoudiniEngineUtils::HapiCreateInputNodeForData(
-    HAPI_NodeId HostAssetId, 
-    UStaticMesh * StaticMesh,
-    HAPI_NodeId & ConnectedAssetId,
-    UStaticMeshComponent* StaticMeshComponent /* = nullptr */)
+FHoudiniEngineUtils::HapiCreateHeightfieldInputNodeForData(
+    HAPI_NodeId HostAssetId,
+    ALandscapeProxy * LandscapeProxy, HAPI_NodeId & ConnectedAssetId,
+    TArray< HAPI_NodeId > & OutCreatedNodeIds, bool bExportOnlySelected )
 {
 #if WITH_EDITOR
 
-    // If we don't have a static mesh, or host asset is invalid, there's nothing to do.
-    if ( !StaticMesh || !FHoudiniEngineUtils::IsHoudiniAssetValid( HostAssetId ) )
+    // If we don't have any landscapes or host asset is invalid then there's nothing to do.
+    if ( !LandscapeProxy || !FHoudiniEngineUtils::IsHoudiniAssetValid( HostAssetId ) )
         return false;
 
-    // Check if connected asset id is valid, if it is not, we need to create an input asset.
-    if ( ConnectedAssetId < 0 )
-    {
-        HAPI_NodeId AssetId = -1;
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateInputNode(
-            FHoudiniEngine::Get().GetSession(), &AssetId, nullptr ), false );
-
-        // Check if we have a valid id for this new input asset.
-        if ( !FHoudiniEngineUtils::IsHoudiniAssetValid( AssetId ) )
-            return false;
-
-        // We now have a valid id.
-        ConnectedAssetId = AssetId;
-
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
-            FHoudiniEngine::Get().GetSession(), AssetId, nullptr ), false );
-    }
+    ULandscapeInfo * LandscapeInfo = LandscapeProxy->GetLandscapeInfo();
+    if ( !LandscapeInfo )
+        return false;
 
     // Get runtime settings.
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-    check( HoudiniRuntimeSettings );
 
     float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
-    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
-    int32 GeneratedLightMapResolution = 32;
-
     if ( HoudiniRuntimeSettings )
-    {
         GeneratedGeometryScaleFactor = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
-        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
-        GeneratedLightMapResolution = HoudiniRuntimeSettings->LightMapResolution;
-    }
 
-    // Grab base LOD level.
-    FStaticMeshSourceModel & SrcModel = StaticMesh->SourceModels[ 0 ];
+    TArray< ULandscapeComponent * > LandscapeComponents;
+    FHoudiniEngineUtils::GetLandscapeComponentsToExport( LandscapeProxy, bExportOnlySelected, LandscapeComponents );
 
-    // Load the existing raw mesh.
-    FRawMesh RawMesh;
-    SrcModel.RawMeshBulkData->LoadRawMesh( RawMesh );
+    // The heightfield covers the extent of the exported components
+    int32 MinX = TNumericLimits< int32 >::Max();
+    int32 MinY = TNumericLimits< int32 >::Max();
+    int32 MaxX = TNumericLimits< int32 >::Lowest();
+    int32 MaxY = TNumericLimits< int32 >::Lowest();
 
-    // Create part.
-    HAPI_PartInfo Part;
-    FMemory::Memzero< HAPI_PartInfo >( Part );
-    Part.id = 0;
-    Part.nameSH = 0;
-    Part.attributeCounts[ HAPI_ATTROWNER_POINT ] = 0;
-    Part.attributeCounts[ HAPI_ATTROWNER_PRIM ] = 0;
-    Part.attributeCounts[ HAPI_ATTROWNER_VERTEX ] = 0;
-    Part.attributeCounts[ HAPI_ATTROWNER_DETAIL ] = 0;
-    Part.vertexCount = RawMesh.WedgeIndices.Num();
-    Part.faceCount = RawMesh.WedgeIndices.Num() / 3;
-    Part.pointCount = RawMesh.VertexPositions.Num();
-    Part.type = HAPI_PARTTYPE_MESH;
-    
-    HAPI_GeoInfo DisplayGeoInfo;
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetDisplayGeoInfo(
-        FHoudiniEngine::Get().GetSession(), ConnectedAssetId, &DisplayGeoInfo ), false );
+    for ( ULandscapeComponent * LandscapeComponent : LandscapeComponents )
+        LandscapeComponent->GetComponentExtent( MinX, MinY, MaxX, MaxY );
 
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetPartInfo(
-        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0, &Part ), false );
+    const int32 XSize = MaxX - MinX + 1;
+    const int32 YSize = MaxY - MinY + 1;
+    if ( ( XSize < 2 ) || ( YSize < 2 ) )
+        return false;
 
-    // Create point attribute info.
-    HAPI_AttributeInfo AttributeInfoPoint;
-    FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoPoint );
-    AttributeInfoPoint.count = RawMesh.VertexPositions.Num();
-    AttributeInfoPoint.tupleSize = 3;
-    AttributeInfoPoint.exists = true;
-    AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
-    AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
-    AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
+    const int32 NumPoints = XSize * YSize;
 
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
-        HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint ), false );
+    // Landscape actor transform.
+    const FTransform & LandscapeTransform = LandscapeProxy->LandscapeActorToWorld();
+    const FVector LandscapeScale = LandscapeTransform.GetScale3D();
+    const float LandscapeZ = LandscapeTransform.GetLocation().Z;
 
-    // Extract vertices from static mesh.
-    TArray< float > StaticMeshVertices;
-    StaticMeshVertices.SetNumZeroed( RawMesh.VertexPositions.Num() * 3 );
-    for ( int32 VertexIdx = 0; VertexIdx < RawMesh.VertexPositions.Num(); ++VertexIdx )
+    FLandscapeEditDataInterface LandscapeEdit( LandscapeInfo );
+
+    // Heightfields are transposed when imported as landscapes, so every volume is exported transposed.
+    // The heights are converted to world space heights in Houdini's units.
+    TArray< float > HeightValues;
     {
-        // Grab vertex at this index.
-        const FVector & PositionVector = RawMesh.VertexPositions[ VertexIdx ];
+        TArray< uint16 > HeightData;
+        HeightData.Init( LandscapeDataAccess::MidValue, NumPoints );
+        LandscapeEdit.GetHeightDataFast( MinX, MinY, MaxX, MaxY, HeightData.GetData(), 0 );
 
-        if ( ImportAxis == HRSAI_Unreal )
-        {
-            StaticMeshVertices[ VertexIdx * 3 + 0 ] = PositionVector.X / GeneratedGeometryScaleFactor;
-            StaticMeshVertices[ VertexIdx * 3 + 1 ] = PositionVector.Z / GeneratedGeometryScaleFactor;
-            StaticMeshVertices[ VertexIdx * 3 + 2 ] = PositionVector.Y / GeneratedGeometryScaleFactor;
-        }
-        else if ( ImportAxis == HRSAI_Houdini )
-        {
-            StaticMeshVertices[ VertexIdx * 3 + 0 ] = PositionVector.X / GeneratedGeometryScaleFactor;
-            StaticMeshVertices[ VertexIdx * 3 + 1 ] = PositionVector.Y / GeneratedGeometryScaleFactor;
-            StaticMeshVertices[ VertexIdx * 3 + 2 ] = PositionVector.Z / GeneratedGeometryScaleFactor;
-        }
-        else
+        FHoudiniEngineUtils::ConvertLandscapeDataToHeightfieldData( XSize, YSize, [&]( int32 LandscapeIdx )
         {
-            // Not valid enum value.
-            check( 0 );
-        }
+            float LocalHeight = LandscapeDataAccess::GetLocalHeight( HeightData[ LandscapeIdx ] );
+            return ( LocalHeight * LandscapeScale.Z + LandscapeZ ) / GeneratedGeometryScaleFactor;
+        }, HeightValues );
     }
 
-    // Now that we have raw positions, we can upload them for our attribute.
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-        0, HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
-        StaticMeshVertices.GetData(), 0,
-        AttributeInfoPoint.count ), false );
-
-    // See if we have texture coordinates to upload.
-    for ( int32 MeshTexCoordIdx = 0; MeshTexCoordIdx < MAX_STATIC_TEXCOORDS; ++MeshTexCoordIdx )
+    // When only the selected components are exported, the bounding box of the selection can contain
+    // unselected components. Their vertices are masked out by a "mask" volume.
+    TArray< float > MaskValues;
+    if ( bExportOnlySelected )
     {
-        int32 StaticMeshUVCount = RawMesh.WedgeTexCoords[ MeshTexCoordIdx ].Num();
-
-        if ( StaticMeshUVCount > 0 )
+        TArray< uint8 > Coverage;
+        Coverage.Init( 0, NumPoints );
+        for ( ULandscapeComponent * LandscapeComponent : LandscapeComponents )
         {
-            const TArray< FVector2D > & RawMeshUVs = RawMesh.WedgeTexCoords[ MeshTexCoordIdx ];
-            TArray< FVector > StaticMeshUVs;
-            StaticMeshUVs.Reserve( StaticMeshUVCount );
-
-            // Transfer UV data.
-            for ( int32 UVIdx = 0; UVIdx < StaticMeshUVCount; ++UVIdx )
-                StaticMeshUVs.Emplace( RawMeshUVs[ UVIdx ].X, 1.0 - RawMeshUVs[ UVIdx ].Y, 0 );
+            int32 ComponentMinX = TNumericLimits< int32 >::Max();
+            int32 ComponentMinY = TNumericLimits< int32 >::Max();
+            int32 ComponentMaxX = TNumericLimits< int32 >::Lowest();
+            int32 ComponentMaxY = TNumericLimits< int32 >::Lowest();
+            LandscapeComponent->GetComponentExtent( ComponentMinX, ComponentMinY, ComponentMaxX, ComponentMaxY );
 
-            if ( ImportAxis == HRSAI_Unreal )
-            {
-                // We need to re-index UVs for wedges we swapped (due to winding differences).
-                for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
-                {
-                    // We do not touch wedge 0 of this triangle.
-                    StaticMeshUVs.SwapMemory( WedgeIdx + 1, WedgeIdx + 2 );
-                }
-            }
-            else if ( ImportAxis == HRSAI_Houdini )
+            for ( int32 nY = ComponentMinY - MinY; nY <= ComponentMaxY - MinY; nY++ )
             {
-                // Do nothing, data is in proper format.
+                FMemory::Memset( &Coverage[ ComponentMinX - MinX + nY * XSize ], 1,
+                    ComponentMaxX - ComponentMinX + 1 );
             }
-            else
+        }
+
+        if ( Coverage.Contains( 0 ) )
+        {
+            FHoudiniEngineUtils::ConvertLandscapeDataToHeightfieldData( XSize, YSize, [&]( int32 LandscapeIdx )
             {
-                // Not valid enum value.
-                check( 0 );
-            }
+                return (float)Coverage[ LandscapeIdx ];
+            }, MaskValues );
+        }
+    }
 
-            // Construct attribute name for this index.
-            std::string UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
+    // The volume is centered on the exported components, and lies on Houdini's XZ plane.
+    HAPI_Transform HeightfieldTransform;
+    FMemory::Memzero< HAPI_Transform >( HeightfieldTransform );
+    {
+        FVector Center = LandscapeTransform.TransformPosition( FVector( ( MinX + MaxX ) * 0.5f, ( MinY + MaxY ) * 0.5f, 0.0f ) );
+        Center /= GeneratedGeometryScaleFactor;
 
-            if ( MeshTexCoordIdx > 0 )
-                UVAttributeName += std::to_string( MeshTexCoordIdx + 1 );
+        HeightfieldTransform.position[ 0 ] = Center.X;
+        HeightfieldTransform.position[ 1 ] = 0.0f;
+        HeightfieldTransform.position[ 2 ] = Center.Y;
 
-            const char * UVAttributeNameString = UVAttributeName.c_str();
+        // Rotates the volume's XY plane to XZ, the volume's Z axis being up.
+        HeightfieldTransform.rotationQuaternion[ 0 ] = -UE_HALF_SQRT_2;
+        HeightfieldTransform.rotationQuaternion[ 1 ] = 0.0f;
+        HeightfieldTransform.rotationQuaternion[ 2 ] = 0.0f;
+        HeightfieldTransform.rotationQuaternion[ 3 ] = UE_HALF_SQRT_2;
 
-            // Create attribute for UVs
-            HAPI_AttributeInfo AttributeInfoVertex;
-            FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoVertex );
-            AttributeInfoVertex.count = StaticMeshUVCount;
-            AttributeInfoVertex.tupleSize = 3;
-            AttributeInfoVertex.exists = true;
-            AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-            AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-            AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-                FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-                0, UVAttributeNameString, &AttributeInfoVertex ), false );
-            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-                FHoudiniEngine::Get().GetSession(),
-                DisplayGeoInfo.nodeId, 0, UVAttributeNameString, &AttributeInfoVertex,
-                (const float *) StaticMeshUVs.GetData(), 0, AttributeInfoVertex.count ), false );
-        }
+        // Volume scales are half a voxel.
+        HeightfieldTransform.scale[ 0 ] = LandscapeScale.Y / GeneratedGeometryScaleFactor * 0.5f;
+        HeightfieldTransform.scale[ 1 ] = LandscapeScale.X / GeneratedGeometryScaleFactor * 0.5f;
+        HeightfieldTransform.scale[ 2 ] = 0.5f;
     }
 
-    // See if we have normals to upload.
-    if ( RawMesh.WedgeTangentZ.Num() > 0 )
-    {
-        TArray< FVector > ChangedNormals( RawMesh.WedgeTangentZ );
+    // Create the merge SOP asset, each volume of the heightfield gets its own input node.
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
+        FHoudiniEngine::Get().GetSession(), -1,
+        "SOP/merge", nullptr, true, &ConnectedAssetId ), false );
 
-        if ( ImportAxis == HRSAI_Unreal )
+    const int32 FirstCreatedNodeIdx = OutCreatedNodeIds.Num();
+    int32 MergeInputIdx = 0;
+    auto AddVolumeInput = [&]( const char * VolumeName, const TArray< float > & VolumeValues,
+        int32 VolumeXLength, int32 VolumeYLength, const HAPI_Transform & VolumeTransform )
+    {
+        HAPI_NodeId VolumeNodeId = -1;
+        if ( !HapiCreateInputNodeForHeightfieldVolume(
+            VolumeName, VolumeValues, VolumeXLength, VolumeYLength, VolumeTransform, VolumeNodeId ) )
         {
-            // We need to re-index normals for wedges we swapped (due to winding differences).
-            for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
-            {
-                FVector TangentZ1 = ChangedNormals[ WedgeIdx + 1 ];
-                FVector TangentZ2 = ChangedNormals[ WedgeIdx + 2 ];
+            HOUDINI_LOG_WARNING( TEXT( "Error creating heightfield volume %s for %s" ),
+                UTF8_TO_TCHAR( VolumeName ), *LandscapeProxy->GetName() );
 
-                ChangedNormals[ WedgeIdx + 1 ] = TangentZ2;
-                ChangedNormals[ WedgeIdx + 2 ] = TangentZ1;
-            }
+            if ( VolumeNodeId >= 0 )
+                FHoudiniEngineUtils::DestroyHoudiniAsset( VolumeNodeId );
 
-            for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); ++WedgeIdx )
-                Swap( ChangedNormals[ WedgeIdx ].Y, ChangedNormals[ WedgeIdx ].Z );
+            return false;
         }
-        else if ( ImportAxis == HRSAI_Houdini )
+
+        OutCreatedNodeIds.Add( VolumeNodeId );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
+            FHoudiniEngine::Get().GetSession(), ConnectedAssetId, MergeInputIdx++,
+            VolumeNodeId ), false );
+
+        return true;
+    };
+
+    bool bSuccess = AddVolumeInput( "height", HeightValues, YSize, XSize, HeightfieldTransform );
+    HeightValues.Empty();
+
+    // Then upload every weight layer as a volume in [0, 1], with the same layout and transform as the height.
+    TArray< uint8 > WeightData;
+    TArray< float > WeightValues;
+    for ( int32 LayerIdx = 0; bSuccess && LayerIdx < LandscapeInfo->Layers.Num(); LayerIdx++ )
+    {
+        const FLandscapeInfoLayerSettings & LayerSettings = LandscapeInfo->Layers[ LayerIdx ];
+        if ( !LayerSettings.LayerInfoObj )
+            continue;
+
+        WeightData.Init( 0, NumPoints );
+        LandscapeEdit.GetWeightDataFast( LayerSettings.LayerInfoObj, MinX, MinY, MaxX, MaxY, WeightData.GetData(), 0 );
+
+        FHoudiniEngineUtils::ConvertLandscapeDataToHeightfieldData( XSize, YSize, [&]( int32 LandscapeIdx )
         {
-            // Do nothing, data is in proper format.
-        }
-        else
+            return WeightData[ LandscapeIdx ] / 255.0f;
+        }, WeightValues );
+
+        // A layer already named mask is restricted to the selection instead.
+        FString LayerName = LayerSettings.GetLayerName().ToString();
+        if ( MaskValues.Num() > 0 && LayerName.Equals( TEXT( "mask" ) ) )
         {
-            // Not valid enum value.
-            check( 0 );
+            for ( int32 Idx = 0; Idx < NumPoints; Idx++ )
+                MaskValues[ Idx ] *= WeightValues[ Idx ];
+
+            continue;
         }
 
-        // Create attribute for normals.
-        HAPI_AttributeInfo AttributeInfoVertex;
-        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoVertex );
-        AttributeInfoVertex.count = ChangedNormals.Num();
-        AttributeInfoVertex.tupleSize = 3;
-        AttributeInfoVertex.exists = true;
-        AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-        AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-        AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex ), false );
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-            FHoudiniEngine::Get().GetSession(),
-            DisplayGeoInfo.nodeId, 0, HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex,
-            (const float *) ChangedNormals.GetData(),
-            0, AttributeInfoVertex.count ), false );
+        std::string LayerNameString;
+        FHoudiniEngineUtils::ConvertUnrealString( LayerName, LayerNameString );
+        bSuccess = AddVolumeInput( LayerNameString.c_str(), WeightValues, YSize, XSize, HeightfieldTransform );
     }
 
-    // See if we have colors to upload.
-    if ( RawMesh.WedgeColors.Num() > 0 )
+    if ( bSuccess && MaskValues.Num() > 0 )
+        bSuccess = AddVolumeInput( "mask", MaskValues, YSize, XSize, HeightfieldTransform );
+
+    if ( !bSuccess )
     {
-        TArray< FLinearColor > ChangedColors;
-        ChangedColors.SetNumUninitialized( RawMesh.WedgeColors.Num() );
+        // Don't leave a partial heightfield behind.
+        for ( int32 Idx = FirstCreatedNodeIdx; Idx < OutCreatedNodeIds.Num(); Idx++ )
+            FHoudiniEngineUtils::DestroyHoudiniAsset( OutCreatedNodeIds[ Idx ] );
+        OutCreatedNodeIds.SetNum( FirstCreatedNodeIdx );
 
-        if ( ImportAxis == HRSAI_Unreal )
+        FHoudiniEngineUtils::DestroyHoudiniAsset( ConnectedAssetId );
+        ConnectedAssetId = -1;
+        return false;
+    }
+
+#endif
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiCreateInputNodeForHeightfieldVolume(
+    const char * VolumeName, const TArray< float > & Values,
+    int32 XLength, int32 YLength, const HAPI_Transform & VolumeTransform,
+    HAPI_NodeId & InputNodeId )
+{
+#if WITH_EDITOR
+
+    if ( Values.Num() != XLength * YLength )
+        return false;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateInputNode(
+        FHoudiniEngine::Get().GetSession(), &InputNodeId, VolumeName ), false );
+
+    if ( !FHoudiniEngineUtils::IsHoudiniAssetValid( InputNodeId ) )
+        return false;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
+        FHoudiniEngine::Get().GetSession(), InputNodeId, nullptr ), false );
+
+    HAPI_GeoInfo DisplayGeoInfo;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetDisplayGeoInfo(
+        FHoudiniEngine::Get().GetSession(), InputNodeId, &DisplayGeoInfo ), false );
+
+    // A volume is a single primitive.
+    HAPI_PartInfo Part;
+    FMemory::Memzero< HAPI_PartInfo >( Part );
+    Part.id = 0;
+    Part.nameSH = 0;
+    Part.type = HAPI_PARTTYPE_VOLUME;
+    Part.faceCount = 1;
+    Part.vertexCount = 1;
+    Part.pointCount = 1;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetPartInfo(
+        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0, &Part ), false );
+
+    HAPI_VolumeInfo VolumeInfo;
+    FMemory::Memzero< HAPI_VolumeInfo >( VolumeInfo );
+    VolumeInfo.type = HAPI_VOLUMETYPE_HOUDINI;
+    VolumeInfo.xLength = XLength;
+    VolumeInfo.yLength = YLength;
+    VolumeInfo.zLength = 1;
+    VolumeInfo.tupleSize = 1;
+    VolumeInfo.storage = HAPI_STORAGETYPE_FLOAT;
+    VolumeInfo.tileSize = HAPI_UNREAL_VOLUME_TILE_SIZE;
+    VolumeInfo.transform = VolumeTransform;
+    VolumeInfo.hasTaper = false;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVolumeInfo(
+        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0, &VolumeInfo ), false );
+
+    // HAPI only sets volumes by 8x8x8 tiles, of which heightfields only use the first slice. The tiles are
+    // staged one slab of TileSize whole rows at a time, so every source row is read once and contiguously.
+    const int32 TileSize = HAPI_UNREAL_VOLUME_TILE_SIZE;
+    const int32 TileValueCount = TileSize * TileSize * TileSize;
+    const int32 TileCountX = FMath::DivideAndRoundUp( XLength, TileSize );
+
+    TArray< float > SlabValues;
+    SlabValues.SetNumZeroed( TileCountX * TileValueCount );
+
+    for ( int32 TileY = 0; TileY < YLength; TileY += TileSize )
+    {
+        const int32 YCount = FMath::Min( TileSize, YLength - TileY );
+
+        // Clear the first slice of the tiles if the slab is partial, so no stale values are sent.
+        if ( YCount < TileSize || XLength % TileSize != 0 )
         {
-            // We need to re-index colors for wedges we swapped (due to winding differences).
-            for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
+            for ( int32 TileIdx = 0; TileIdx < TileCountX; TileIdx++ )
+                FMemory::Memzero( &SlabValues[ TileIdx * TileValueCount ], TileSize * TileSize * sizeof( float ) );
+        }
+
+        for ( int32 nY = 0; nY < YCount; nY++ )
+        {
+            const float * SourceRow = &Values[ ( TileY + nY ) * XLength ];
+            for ( int32 TileIdx = 0; TileIdx < TileCountX; TileIdx++ )
             {
-                ChangedColors[ WedgeIdx + 0 ] = FLinearColor( RawMesh.WedgeColors[ WedgeIdx + 0 ] );
-                ChangedColors[ WedgeIdx + 1 ] = FLinearColor( RawMesh.WedgeColors[ WedgeIdx + 2 ] );
-                ChangedColors[ WedgeIdx + 2 ] = FLinearColor( RawMesh.WedgeColors[ WedgeIdx + 1 ] );
+                const int32 TileX = TileIdx * TileSize;
+                FMemory::Memcpy(
+                    &SlabValues[ TileIdx * TileValueCount + nY * TileSize ],
+                    SourceRow + TileX,
+                    FMath::Min( TileSize, XLength - TileX ) * sizeof( float ) );
             }
         }
-        else if ( ImportAxis == HRSAI_Houdini )
+
+        for ( int32 TileIdx = 0; TileIdx < TileCountX; TileIdx++ )
         {
-            ChangedColors = TArray< FLinearColor >( RawMesh.WedgeColors );
+            HAPI_VolumeTileInfo TileInfo;
+            TileInfo.minX = TileIdx * TileSize;
+            TileInfo.minY = TileY;
+            TileInfo.minZ = 0;
+            TileInfo.isValid = true;
+
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVolumeTileFloatData(
+                FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+                &TileInfo, &SlabValues[ TileIdx * TileValueCount ], TileValueCount ), false );
         }
+    }
+
+    // The name of the volume is stored in the name primitive attribute.
+    {
+        HAPI_AttributeInfo AttributeInfoPrimitiveName;
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoPrimitiveName );
+        AttributeInfoPrimitiveName.count = 1;
+        AttributeInfoPrimitiveName.tupleSize = 1;
+        AttributeInfoPrimitiveName.exists = true;
+        AttributeInfoPrimitiveName.owner = HAPI_ATTROWNER_PRIM;
+        AttributeInfoPrimitiveName.storage = HAPI_STORAGETYPE_STRING;
+        AttributeInfoPrimitiveName.originalOwner = HAPI_ATTROWNER_INVALID;
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+            HAPI_ATTRIB_NAME, &AttributeInfoPrimitiveName ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeStringData(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+            HAPI_ATTRIB_NAME, &AttributeInfoPrimitiveName,
+            &VolumeName, 0, AttributeInfoPrimitiveName.count ), false );
+    }
+
+    // Commit the geo.
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CommitGeo(
+        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId ), false );
+
+#endif
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiCreateInputNodeForData(
+    HAPI_NodeId HostAssetId, 
+    USplineComponent * SplineComponent,
+    HAPI_NodeId & ConnectedAssetId,
+    FHoudiniAssetInputOutlinerMesh& OutlinerMesh,
+    const float& SplineResolution)
+{
+#if WITH_EDITOR
+
+    // If we don't have a spline component, or host asset is invalid, there's nothing to do.
+    if (!SplineComponent || !FHoudiniEngineUtils::IsHoudiniAssetValid(HostAssetId))
+        return false;
+        
+    float fSplineResolution = SplineResolution;
+    if (fSplineResolution == -1.0f)
+    {
+        // Get runtime settings and extract the spline resolution from it
+        const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+        if (HoudiniRuntimeSettings)
+            fSplineResolution = HoudiniRuntimeSettings->MarshallingSplineResolution;
         else
+            fSplineResolution = HAPI_UNREAL_PARAM_SPLINE_RESOLUTION_DEFAULT;
+    }
+
+    int32 nNumberOfControlPoints = SplineComponent->GetNumberOfSplinePoints();
+    float fSplineLength = SplineComponent->GetSplineLength();  
+
+    // Calculate the number of refined point we want
+    int32 nNumberOfRefinedSplinePoints = fSplineResolution > 0.0f ? ceil(fSplineLength / fSplineResolution) + 1 : nNumberOfControlPoints;
+    
+    // Array that will store the attributes we want to add to the curves
+    TArray<FVector> tRefinedSplinePositions;
+    TArray<FQuat> tRefinedSplineRotations;    
+    // Scale on Unreal's spline will require some tweaking, as the XScale is always 1
+    TArray<FVector> tRefinedSplineScales;
+    //TArray<float> tRefinedSplinePScales;
+
+    if ( (nNumberOfRefinedSplinePoints < nNumberOfControlPoints) || (fSplineResolution <= 0.0f) )
+    {
+        // There's not enough refined points, so we'll use the Spline CVs instead
+        tRefinedSplinePositions.SetNumZeroed(nNumberOfControlPoints);
+        tRefinedSplineRotations.SetNumZeroed(nNumberOfControlPoints);
+        tRefinedSplineScales.SetNumZeroed(nNumberOfControlPoints);
+        //tRefinedSplinePScales.SetNumZeroed(nNumberOfControlPoints);
+
+        FVector Scale;
+        for (int32 n = 0; n < nNumberOfControlPoints; n++)
         {
-            // Not valid enum value.
-            check( 0 );
+            tRefinedSplinePositions[n] = SplineComponent->GetLocationAtSplinePoint(n, ESplineCoordinateSpace::Local);
+            tRefinedSplineRotations[n] = SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World);
+
+            Scale = SplineComponent->GetScaleAtSplinePoint(n);
+            tRefinedSplineScales[n] = Scale;
+            // tRefinedSplinePScales[n] = (Scale.Y + Scale.Z) / 2.0f; //FMath::Max(Scale.Y, Scale.Z);
+        }           
+    }
+    else
+    {
+        // Calculating the refined spline points
+        tRefinedSplinePositions.SetNumZeroed(nNumberOfRefinedSplinePoints);
+        tRefinedSplineRotations.SetNumZeroed(nNumberOfRefinedSplinePoints);
+        tRefinedSplineScales.SetNumZeroed(nNumberOfRefinedSplinePoints);
+        // tRefinedSplinePScales.SetNumZeroed(nNumberOfRefinedSplinePoints);
+        
+        FVector Scale;
+        float fCurrentDistance = 0.0f;
+        for (int32 n = 0; n < nNumberOfRefinedSplinePoints; n++)
+        {    
+            tRefinedSplinePositions[n] = SplineComponent->GetLocationAtDistanceAlongSpline(fCurrentDistance, ESplineCoordinateSpace::Local);
+            tRefinedSplineRotations[n] = SplineComponent->GetQuaternionAtDistanceAlongSpline(fCurrentDistance, ESplineCoordinateSpace::World);
+            
+            Scale = SplineComponent->GetScaleAtDistanceAlongSpline(fCurrentDistance);
+
+            tRefinedSplineScales[n] = Scale;
+            // tRefinedSplinePScales[n] = (Scale.Y + Scale.Z) / 2.0f; //FMath::Max(Scale.Y, Scale.Z);
+
+            fCurrentDistance += fSplineResolution;
         }
+    }
 
-        // Create attribute for colors.
-        HAPI_AttributeInfo AttributeInfoVertex;
-        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoVertex );
-        AttributeInfoVertex.count = ChangedColors.Num();
-        AttributeInfoVertex.tupleSize = 4;
-        AttributeInfoVertex.exists = true;
-        AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
-        AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
-        AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex ), false );
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
-            FHoudiniEngine::Get().GetSession(),
-            DisplayGeoInfo.nodeId, 0, HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex,
-            (const float *) ChangedColors.GetData(), 0, AttributeInfoVertex.count ), false );
+    if ( !HapiCreateCurveInputNodeForData(
+            HostAssetId, 
+            ConnectedAssetId,
+            &tRefinedSplinePositions,
+            &tRefinedSplineRotations,
+            &tRefinedSplineScales,
+            nullptr) )//&tRefinedSplinePScales) )
+        return false;
+
+    // Updating the OutlinerMesh's struct infos
+    OutlinerMesh.SplineResolution = fSplineResolution;
+    OutlinerMesh.SplineLength = fSplineLength;
+    OutlinerMesh.NumberOfSplineControlPoints = nNumberOfControlPoints;
+
+    // We also need to extract all the CV's Transform to check for modifications
+    OutlinerMesh.SplineControlPointsTransform.SetNum(nNumberOfControlPoints);
+    for ( int32 n = 0; n < nNumberOfControlPoints; n++ )
+    {
+        // Getting the Local Transform for positions and scale
+        OutlinerMesh.SplineControlPointsTransform[n] = SplineComponent->GetTransformAtSplinePoint(n, ESplineCoordinateSpace::Local, true);
+
+        // ... but we used we used the world rotation
+        OutlinerMesh.SplineControlPointsTransform[n].SetRotation(SplineComponent->GetQuaternionAtSplinePoint(n, ESplineCoordinateSpace::World));
     }
 
-    // Extract indices from static mesh.
-    if ( RawMesh.WedgeIndices.Num() > 0 )
+    // Cook the spline node.
+    FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), ConnectedAssetId, nullptr);
+
+#endif
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiCreateInputNodeForData(
+    HAPI_NodeId HostAssetId, 
+    UStaticMesh * StaticMesh,
+    HAPI_NodeId & ConnectedAssetId,
+    UStaticMeshComponent* StaticMeshComponent /* = nullptr */)
+{
+#if WITH_EDITOR
+
+    // If we don't have a static mesh, or host asset is invalid, there's nothing to do.
+    if ( !StaticMesh || !FHoudiniEngineUtils::IsHoudiniAssetValid( HostAssetId ) )
+        return false;
+
+    // Check if connected asset id is valid, if it is not, we need to create an input asset.
+    if ( ConnectedAssetId < 0 )
     {
-        TArray< int32 > StaticMeshIndices;
-        StaticMeshIndices.SetNumUninitialized( RawMesh.WedgeIndices.Num() );
+        HAPI_NodeId AssetId = -1;
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateInputNode(
+            FHoudiniEngine::Get().GetSession(), &AssetId, nullptr ), false );
+
+        // Check if we have a valid id for this new input asset.
+        if ( !FHoudiniEngineUtils::IsHoudiniAssetValid( AssetId ) )
+            return false;
+
+        // We now have a valid id.
+        ConnectedAssetId = AssetId;
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CookNode(
+            FHoudiniEngine::Get().GetSession(), AssetId, nullptr ), false );
+    }
+
+    // Get runtime settings.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    check( HoudiniRuntimeSettings );
+
+    float GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
+    EHoudiniRuntimeSettingsAxisImport ImportAxis = HRSAI_Unreal;
+    int32 GeneratedLightMapResolution = 32;
+
+    if ( HoudiniRuntimeSettings )
+    {
+        GeneratedGeometryScaleFactor = HoudiniRuntimeSettings->GeneratedGeometryScaleFactor;
+        ImportAxis = HoudiniRuntimeSettings->ImportAxis;
+        GeneratedLightMapResolution = HoudiniRuntimeSettings->LightMapResolution;
+    }
+
+    // Grab base LOD level.
+    FStaticMeshSourceModel & SrcModel = StaticMesh->SourceModels[ 0 ];
+
+    // Load the existing raw mesh.
+    FRawMesh RawMesh;
+    SrcModel.RawMeshBulkData->LoadRawMesh( RawMesh );
+
+    // Create part.
+    HAPI_PartInfo Part;
+    FMemory::Memzero< HAPI_PartInfo >( Part );
+    Part.id = 0;
+    Part.nameSH = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_POINT ] = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_PRIM ] = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_VERTEX ] = 0;
+    Part.attributeCounts[ HAPI_ATTROWNER_DETAIL ] = 0;
+    Part.vertexCount = RawMesh.WedgeIndices.Num();
+    Part.faceCount = RawMesh.WedgeIndices.Num() / 3;
+    Part.pointCount = RawMesh.VertexPositions.Num();
+    Part.type = HAPI_PARTTYPE_MESH;
+    
+    HAPI_GeoInfo DisplayGeoInfo;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetDisplayGeoInfo(
+        FHoudiniEngine::Get().GetSession(), ConnectedAssetId, &DisplayGeoInfo ), false );
+
+    // Attribute data components write their attributes straight to the geometry node, the part can't be encoded then.
+    const bool bHasAttributeDataComponent = StaticMeshComponent && StaticMeshComponent->GetOwner()
+        && StaticMeshComponent->GetOwner()->FindComponentByClass< UHoudiniAttributeDataComponent >();
+
+    // Stage the part, it is either encoded and sent as a single geometry buffer or sent attribute by attribute.
+    FHoudiniGeoEncoder GeoEncoder(
+        DisplayGeoInfo.nodeId, FHoudiniGeoEncoder::IsEncodingEnabled() && !bHasAttributeDataComponent );
+
+    HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetPartInfo( &Part ), false );
+
+    // Create point attribute info.
+    HAPI_AttributeInfo AttributeInfoPoint;
+    FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoPoint );
+    AttributeInfoPoint.count = RawMesh.VertexPositions.Num();
+    AttributeInfoPoint.tupleSize = 3;
+    AttributeInfoPoint.exists = true;
+    AttributeInfoPoint.owner = HAPI_ATTROWNER_POINT;
+    AttributeInfoPoint.storage = HAPI_STORAGETYPE_FLOAT;
+    AttributeInfoPoint.originalOwner = HAPI_ATTROWNER_INVALID;
+
+    HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint ), false );
+
+    // Extract vertices from static mesh.
+    TArray< float > StaticMeshVertices;
+    StaticMeshVertices.SetNumZeroed( RawMesh.VertexPositions.Num() * 3 );
+    for ( int32 VertexIdx = 0; VertexIdx < RawMesh.VertexPositions.Num(); ++VertexIdx )
+    {
+        // Grab vertex at this index.
+        const FVector & PositionVector = RawMesh.VertexPositions[ VertexIdx ];
 
         if ( ImportAxis == HRSAI_Unreal )
         {
-            for ( int32 IndexIdx = 0; IndexIdx < RawMesh.WedgeIndices.Num(); IndexIdx += 3 )
-            {
-                // Swap indices to fix winding order.
-                StaticMeshIndices[ IndexIdx + 0 ] = RawMesh.WedgeIndices[ IndexIdx + 0 ];
-                StaticMeshIndices[ IndexIdx + 1 ] = RawMesh.WedgeIndices[ IndexIdx + 2 ];
-                StaticMeshIndices[ IndexIdx + 2 ] = RawMesh.WedgeIndices[ IndexIdx + 1 ];
-            }
+            StaticMeshVertices[ VertexIdx * 3 + 0 ] = PositionVector.X / GeneratedGeometryScaleFactor;
+            StaticMeshVertices[ VertexIdx * 3 + 1 ] = PositionVector.Z / GeneratedGeometryScaleFactor;
+            StaticMeshVertices[ VertexIdx * 3 + 2 ] = PositionVector.Y / GeneratedGeometryScaleFactor;
         }
         else if ( ImportAxis == HRSAI_Houdini )
         {
-            StaticMeshIndices = TArray< int32 >( RawMesh.WedgeIndices );
+            StaticMeshVertices[ VertexIdx * 3 + 0 ] = PositionVector.X / GeneratedGeometryScaleFactor;
+            StaticMeshVertices[ VertexIdx * 3 + 1 ] = PositionVector.Y / GeneratedGeometryScaleFactor;
+            StaticMeshVertices[ VertexIdx * 3 + 2 ] = PositionVector.Z / GeneratedGeometryScaleFactor;
         }
         else
         {
             // Not valid enum value.
             check( 0 );
         }
+    }
+
+    // Now that we have raw positions, we can upload them for our attribute.
+    HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeFloatData( HAPI_UNREAL_ATTRIB_POSITION, &AttributeInfoPoint,
+        StaticMeshVertices.GetData(), 0,
+        AttributeInfoPoint.count ), false );
+
+    // See if we have texture coordinates to upload.
+    for ( int32 MeshTexCoordIdx = 0; MeshTexCoordIdx < MAX_STATIC_TEXCOORDS; ++MeshTexCoordIdx )
+    {
+        int32 StaticMeshUVCount = RawMesh.WedgeTexCoords[ MeshTexCoordIdx ].Num();
+
+        if ( StaticMeshUVCount > 0 )
+        {
+            const TArray< FVector2D > & RawMeshUVs = RawMesh.WedgeTexCoords[ MeshTexCoordIdx ];
+            TArray< FVector > StaticMeshUVs;
+            StaticMeshUVs.Reserve( StaticMeshUVCount );
+
+            // Transfer UV data.
+            for ( int32 UVIdx = 0; UVIdx < StaticMeshUVCount; ++UVIdx )
+                StaticMeshUVs.Emplace( RawMeshUVs[ UVIdx ].X, 1.0 - RawMeshUVs[ UVIdx ].Y, 0 );
+
+            if ( ImportAxis == HRSAI_Unreal )
+            {
+                // We need to re-index UVs for wedges we swapped (due to winding differences).
+                for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
+                {
+                    // We do not touch wedge 0 of this triangle.
+                    StaticMeshUVs.SwapMemory( WedgeIdx + 1, WedgeIdx + 2 );
+                }
+            }
+            else if ( ImportAxis == HRSAI_Houdini )
+            {
+                // Do nothing, data is in proper format.
+            }
+            else
+            {
+                // Not valid enum value.
+                check( 0 );
+            }
+
+            // Construct attribute name for this index.
+            std::string UVAttributeName = HAPI_UNREAL_ATTRIB_UV;
+
+            if ( MeshTexCoordIdx > 0 )
+                UVAttributeName += std::to_string( MeshTexCoordIdx + 1 );
+
+            const char * UVAttributeNameString = UVAttributeName.c_str();
+
+            // Create attribute for UVs
+            HAPI_AttributeInfo AttributeInfoVertex;
+            FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoVertex );
+            AttributeInfoVertex.count = StaticMeshUVCount;
+            AttributeInfoVertex.tupleSize = 3;
+            AttributeInfoVertex.exists = true;
+            AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+            AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+            AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
+            HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( UVAttributeNameString, &AttributeInfoVertex ), false );
+            HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeFloatData( UVAttributeNameString, &AttributeInfoVertex,
+                (const float *) StaticMeshUVs.GetData(), 0, AttributeInfoVertex.count ), false );
+        }
+    }
+
+    // See if we have normals to upload.
+    if ( RawMesh.WedgeTangentZ.Num() > 0 )
+    {
+        TArray< FVector > ChangedNormals( RawMesh.WedgeTangentZ );
+
+        if ( ImportAxis == HRSAI_Unreal )
+        {
+            // We need to re-index normals for wedges we swapped (due to winding differences).
+            for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
+            {
+                FVector TangentZ1 = ChangedNormals[ WedgeIdx + 1 ];
+                FVector TangentZ2 = ChangedNormals[ WedgeIdx + 2 ];
+
+                ChangedNormals[ WedgeIdx + 1 ] = TangentZ2;
+                ChangedNormals[ WedgeIdx + 2 ] = TangentZ1;
+            }
+
+            for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); ++WedgeIdx )
+                Swap( ChangedNormals[ WedgeIdx ].Y, ChangedNormals[ WedgeIdx ].Z );
+        }
+        else if ( ImportAxis == HRSAI_Houdini )
+        {
+            // Do nothing, data is in proper format.
+        }
+        else
+        {
+            // Not valid enum value.
+            check( 0 );
+        }
+
+        // Create attribute for normals.
+        HAPI_AttributeInfo AttributeInfoVertex;
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoVertex );
+        AttributeInfoVertex.count = ChangedNormals.Num();
+        AttributeInfoVertex.tupleSize = 3;
+        AttributeInfoVertex.exists = true;
+        AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+        AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+        AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex ), false );
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeFloatData( HAPI_UNREAL_ATTRIB_NORMAL, &AttributeInfoVertex,
+            (const float *) ChangedNormals.GetData(),
+            0, AttributeInfoVertex.count ), false );
+    }
+
+    // See if we have colors to upload.
+    if ( RawMesh.WedgeColors.Num() > 0 )
+    {
+        TArray< FLinearColor > ChangedColors;
+        ChangedColors.SetNumUninitialized( RawMesh.WedgeColors.Num() );
+
+        if ( ImportAxis == HRSAI_Unreal )
+        {
+            // We need to re-index colors for wedges we swapped (due to winding differences).
+            for ( int32 WedgeIdx = 0; WedgeIdx < RawMesh.WedgeIndices.Num(); WedgeIdx += 3 )
+            {
+                ChangedColors[ WedgeIdx + 0 ] = FLinearColor( RawMesh.WedgeColors[ WedgeIdx + 0 ] );
+                ChangedColors[ WedgeIdx + 1 ] = FLinearColor( RawMesh.WedgeColors[ WedgeIdx + 2 ] );
+                ChangedColors[ WedgeIdx + 2 ] = FLinearColor( RawMesh.WedgeColors[ WedgeIdx + 1 ] );
+            }
+        }
+        else if ( ImportAxis == HRSAI_Houdini )
+        {
+            ChangedColors = TArray< FLinearColor >( RawMesh.WedgeColors );
+        }
+        else
+        {
+            // Not valid enum value.
+            check( 0 );
+        }
+
+        // Create attribute for colors.
+        HAPI_AttributeInfo AttributeInfoVertex;
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoVertex );
+        AttributeInfoVertex.count = ChangedColors.Num();
+        AttributeInfoVertex.tupleSize = 4;
+        AttributeInfoVertex.exists = true;
+        AttributeInfoVertex.owner = HAPI_ATTROWNER_VERTEX;
+        AttributeInfoVertex.storage = HAPI_STORAGETYPE_FLOAT;
+        AttributeInfoVertex.originalOwner = HAPI_ATTROWNER_INVALID;
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex ), false );
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeFloatData( HAPI_UNREAL_ATTRIB_COLOR, &AttributeInfoVertex,
+            (const float *) ChangedColors.GetData(), 0, AttributeInfoVertex.count ), false );
+    }
+
+    // Extract indices from static mesh.
+    if ( RawMesh.WedgeIndices.Num() > 0 )
+    {
+        TArray< int32 > StaticMeshIndices;
+        StaticMeshIndices.SetNumUninitialized( RawMesh.WedgeIndices.Num() );
+
+        if ( ImportAxis == HRSAI_Unreal )
+        {
+            for ( int32 IndexIdx = 0; IndexIdx < RawMesh.WedgeIndices.Num(); IndexIdx += 3 )
+            {
+                // Swap indices to fix winding order.
+                StaticMeshIndices[ IndexIdx + 0 ] = RawMesh.WedgeIndices[ IndexIdx + 0 ];
+                StaticMeshIndices[ IndexIdx + 1 ] = RawMesh.WedgeIndices[ IndexIdx + 2 ];
+                StaticMeshIndices[ IndexIdx + 2 ] = RawMesh.WedgeIndices[ IndexIdx + 1 ];
+            }
+        }
+        else if ( ImportAxis == HRSAI_Houdini )
+        {
+            StaticMeshIndices = TArray< int32 >( RawMesh.WedgeIndices );
+        }
+        else
+        {
+            // Not valid enum value.
+            check( 0 );
+        }
+
+        // We can now set vertex list.
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetVertexList( StaticMeshIndices.GetData(), 0, StaticMeshIndices.Num() ), false );
+
+        // We need to generate array of face counts.
+        TArray< int32 > StaticMeshFaceCounts;
+        StaticMeshFaceCounts.Init( 3, Part.faceCount );
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetFaceCounts( StaticMeshFaceCounts.GetData(), 0, StaticMeshFaceCounts.Num() ), false );
+    }
+
+    // Marshall face material indices.
+    if ( RawMesh.FaceMaterialIndices.Num() > 0 )
+    {
+        // Create list of materials, one for each face.
+        TArray< char * > StaticMeshFaceMaterials;
+        FHoudiniEngineUtils::CreateFaceMaterialArray(
+            StaticMesh->StaticMaterials, RawMesh.FaceMaterialIndices,
+            StaticMeshFaceMaterials );
+
+        // Get name of attribute used for marshalling materials.
+        std::string MarshallingAttributeName = HAPI_UNREAL_ATTRIB_MATERIAL;
+        if ( HoudiniRuntimeSettings && !HoudiniRuntimeSettings->MarshallingAttributeMaterial.IsEmpty() )
+            FHoudiniEngineUtils::ConvertUnrealString(
+                HoudiniRuntimeSettings->MarshallingAttributeMaterial, MarshallingAttributeName );
+
+        // Create attribute for materials.
+        HAPI_AttributeInfo AttributeInfoMaterial;
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoMaterial );
+        AttributeInfoMaterial.count = RawMesh.FaceMaterialIndices.Num();
+        AttributeInfoMaterial.tupleSize = 1;
+        AttributeInfoMaterial.exists = true;
+        AttributeInfoMaterial.owner = HAPI_ATTROWNER_PRIM;
+        AttributeInfoMaterial.storage = HAPI_STORAGETYPE_STRING;
+        AttributeInfoMaterial.originalOwner = HAPI_ATTROWNER_INVALID;
+
+        bool bAttributeError = false;
+
+        if ( GeoEncoder.AddAttribute( MarshallingAttributeName.c_str(), &AttributeInfoMaterial ) != HAPI_RESULT_SUCCESS )
+        {
+            bAttributeError = true;
+        }
+
+        if ( GeoEncoder.SetAttributeStringData( MarshallingAttributeName.c_str(), &AttributeInfoMaterial,
+            (const char **) StaticMeshFaceMaterials.GetData(), 0,
+            StaticMeshFaceMaterials.Num() ) != HAPI_RESULT_SUCCESS )
+        {
+            bAttributeError = true;
+        }
+
+        // Delete material names.
+        FHoudiniEngineUtils::DeleteFaceMaterialArray( StaticMeshFaceMaterials );
+
+        if ( bAttributeError )
+        {
+            check( 0 );
+            return false;
+        }
+    }
+
+    // Marshall face smoothing masks.
+    if ( RawMesh.FaceSmoothingMasks.Num() > 0 )
+    {
+        // Get name of attribute used for marshalling face smoothing masks.
+        std::string MarshallingAttributeName = HAPI_UNREAL_ATTRIB_FACE_SMOOTHING_MASK;
+        if ( HoudiniRuntimeSettings && !HoudiniRuntimeSettings->MarshallingAttributeMaterial.IsEmpty() )
+        {
+            FHoudiniEngineUtils::ConvertUnrealString(
+                HoudiniRuntimeSettings->MarshallingAttributeFaceSmoothingMask,
+                MarshallingAttributeName );
+        }
+
+        HAPI_AttributeInfo AttributeInfoSmoothingMasks;
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoSmoothingMasks );
+        AttributeInfoSmoothingMasks.count = RawMesh.FaceSmoothingMasks.Num();
+        AttributeInfoSmoothingMasks.tupleSize = 1;
+        AttributeInfoSmoothingMasks.exists = true;
+        AttributeInfoSmoothingMasks.owner = HAPI_ATTROWNER_PRIM;
+        AttributeInfoSmoothingMasks.storage = HAPI_STORAGETYPE_INT;
+        AttributeInfoSmoothingMasks.originalOwner = HAPI_ATTROWNER_INVALID;
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( MarshallingAttributeName.c_str(), &AttributeInfoSmoothingMasks ), false );
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeIntData( MarshallingAttributeName.c_str(), &AttributeInfoSmoothingMasks,
+            (const int32 *) RawMesh.FaceSmoothingMasks.GetData(), 0, RawMesh.FaceSmoothingMasks.Num() ), false );
+    }
+
+    // Marshall lightmap resolution.
+    if ( StaticMesh->LightMapResolution != GeneratedLightMapResolution )
+    {
+        std::string MarshallingAttributeName = HAPI_UNREAL_ATTRIB_LIGHTMAP_RESOLUTION;
+        if ( HoudiniRuntimeSettings && !HoudiniRuntimeSettings->MarshallingAttributeLightmapResolution.IsEmpty() )
+        {
+            FHoudiniEngineUtils::ConvertUnrealString(
+                HoudiniRuntimeSettings->MarshallingAttributeLightmapResolution,
+                MarshallingAttributeName );
+        }
+
+        TArray< int32 > LightMapResolutions;
+        LightMapResolutions.Add( StaticMesh->LightMapResolution );
+
+        HAPI_AttributeInfo AttributeInfoLightMapResolution;
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoLightMapResolution );
+        AttributeInfoLightMapResolution.count = LightMapResolutions.Num();
+        AttributeInfoLightMapResolution.tupleSize = 1;
+        AttributeInfoLightMapResolution.exists = true;
+        AttributeInfoLightMapResolution.owner = HAPI_ATTROWNER_DETAIL;
+        AttributeInfoLightMapResolution.storage = HAPI_STORAGETYPE_INT;
+        AttributeInfoLightMapResolution.originalOwner = HAPI_ATTROWNER_INVALID;
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( MarshallingAttributeName.c_str(), &AttributeInfoLightMapResolution ), false );
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeIntData( MarshallingAttributeName.c_str(), &AttributeInfoLightMapResolution,
+            (const int32 *) LightMapResolutions.GetData(), 0, LightMapResolutions.Num() ), false );
+    }
+
+    if ( !HoudiniRuntimeSettings->MarshallingAttributeInputMeshName.IsEmpty() )
+    {
+        // Create primitive attribute with mesh asset path
+
+        FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>( "AssetRegistry" );
+        const FString MeshAssetPath = StaticMesh->GetPathName();
+        std::string MeshAssetPathCStr = TCHAR_TO_ANSI( *MeshAssetPath );
+        const char* MeshAssetPathRaw = MeshAssetPathCStr.c_str();
+        TArray<const char*> PrimitiveAttrs;
+        PrimitiveAttrs.AddUninitialized( Part.faceCount );
+        for ( int32 Ix = 0; Ix < Part.faceCount; ++Ix )
+        {
+            PrimitiveAttrs[ Ix ] = MeshAssetPathRaw;
+        }
+
+        std::string MarshallingAttributeName;
+        FHoudiniEngineUtils::ConvertUnrealString(
+            HoudiniRuntimeSettings->MarshallingAttributeInputMeshName,
+            MarshallingAttributeName );
+        
+        HAPI_AttributeInfo AttributeInfo {};
+        AttributeInfo.count = Part.faceCount;
+        AttributeInfo.tupleSize = 1;
+        AttributeInfo.exists = true;
+        AttributeInfo.owner = HAPI_ATTROWNER_PRIM;
+        AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
+        AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.AddAttribute( MarshallingAttributeName.c_str(), &AttributeInfo ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.SetAttributeStringData( MarshallingAttributeName.c_str(), &AttributeInfo,
+            PrimitiveAttrs.GetData(), 0, PrimitiveAttrs.Num() ), false );
+    }
+
+    // Check if we have vertex attribute data to add
+    if ( StaticMeshComponent && StaticMeshComponent->GetOwner() )
+    {
+        if ( UHoudiniAttributeDataComponent* DataComponent = StaticMeshComponent->GetOwner()->FindComponentByClass<UHoudiniAttributeDataComponent>() )
+        {
+            bool bSuccess = DataComponent->Upload( DisplayGeoInfo.nodeId, StaticMeshComponent );
+            if ( !bSuccess )
+            {
+                HOUDINI_LOG_ERROR( TEXT( "Upload of attribute data for %s failed" ), *StaticMeshComponent->GetOwner()->GetName() );
+            }
+        }
+    }
+
+    // Commit the geo.
+    HOUDINI_CHECK_ERROR_RETURN( GeoEncoder.CommitGeo(), false );
+
+#endif
+
+    return true;
+}
+
+uint32
+FHoudiniEngineUtils::GetStaticMeshInputKey( UStaticMesh * StaticMesh, UStaticMeshComponent * StaticMeshComponent )
+{
+#if WITH_EDITOR
+
+    if ( !StaticMesh || StaticMesh->SourceModels.Num() <= 0 || !StaticMesh->SourceModels[ 0 ].RawMeshBulkData )
+        return 0;
+
+    // Attribute data components upload their own data with the mesh, these inputs can't be cached.
+    if ( StaticMeshComponent && StaticMeshComponent->GetOwner()
+        && StaticMeshComponent->GetOwner()->FindComponentByClass< UHoudiniAttributeDataComponent >() )
+        return 0;
+
+    // The raw mesh bulk data id changes every time LOD0's raw mesh is saved.
+    uint32 MeshKey = GetTypeHash( StaticMesh->SourceModels[ 0 ].RawMeshBulkData->GetIdString() );
+    MeshKey = HashCombine( MeshKey, GetTypeHash( StaticMesh->GetPathName() ) );
+    MeshKey = HashCombine( MeshKey, GetTypeHash( StaticMesh->LightMapResolution ) );
+
+    for ( const FStaticMaterial & StaticMaterial : StaticMesh->StaticMaterials )
+        MeshKey = HashCombine( MeshKey, PointerHash( StaticMaterial.MaterialInterface ) );
+
+    // The marshalling settings change the uploaded geometry as well.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings )
+    {
+        MeshKey = HashCombine( MeshKey, GetTypeHash( HoudiniRuntimeSettings->GeneratedGeometryScaleFactor ) );
+        MeshKey = HashCombine( MeshKey, GetTypeHash( (int32) HoudiniRuntimeSettings->ImportAxis ) );
+        MeshKey = HashCombine( MeshKey, GetTypeHash( HoudiniRuntimeSettings->LightMapResolution ) );
+        MeshKey = HashCombine( MeshKey, GetTypeHash( HoudiniRuntimeSettings->MarshallingAttributeMaterial ) );
+        MeshKey = HashCombine( MeshKey, GetTypeHash( HoudiniRuntimeSettings->MarshallingAttributeFaceSmoothingMask ) );
+        MeshKey = HashCombine( MeshKey, GetTypeHash( HoudiniRuntimeSettings->MarshallingAttributeLightmapResolution ) );
+        MeshKey = HashCombine( MeshKey, GetTypeHash( HoudiniRuntimeSettings->MarshallingAttributeInputMeshName ) );
+    }
+
+    // Zero is reserved for inputs that must always be uploaded.
+    return MeshKey != 0 ? MeshKey : 1;
+
+#else
+
+    return 0;
+
+#endif
+}
+
+bool
+FHoudiniEngineUtils::HapiCreateSharedInputNodeForData(
+    HAPI_NodeId HostAssetId, UStaticMesh * StaticMesh,
+    UStaticMeshComponent * StaticMeshComponent, HAPI_NodeId & ObjectMergeNodeId )
+{
+#if WITH_EDITOR
+
+    // If we don't have a static mesh, or host asset is invalid, there's nothing to do.
+    if ( !StaticMesh || !FHoudiniEngineUtils::IsHoudiniAssetValid( HostAssetId ) )
+        return false;
+
+    // Meshes that can't be cached can't be shared either.
+    const uint32 MeshKey = FHoudiniEngineUtils::GetStaticMeshInputKey( StaticMesh, StaticMeshComponent );
+    if ( MeshKey == 0 )
+        return false;
+
+    TMap< TWeakObjectPtr< UStaticMesh >, FHoudiniEngineSharedMeshInput > & SharedMeshInputs =
+        FHoudiniEngine::Get().GetSharedMeshInputs();
+
+    FHoudiniEngineSharedMeshInput & SharedMeshInput = SharedMeshInputs.FindOrAdd( StaticMesh );
+    if ( SharedMeshInput.NodeId >= 0 && !FHoudiniEngineUtils::IsHoudiniAssetValid( SharedMeshInput.NodeId ) )
+    {
+        SharedMeshInput.NodeId = -1;
+        SharedMeshInput.MeshKey = 0;
+    }
+
+    // Upload the mesh the first time, or again if it changed. All the inputs referencing it get the new geometry.
+    if ( SharedMeshInput.NodeId < 0 || SharedMeshInput.MeshKey != MeshKey )
+    {
+        if ( !FHoudiniEngineUtils::HapiCreateInputNodeForData( HostAssetId, StaticMesh, SharedMeshInput.NodeId, nullptr ) )
+        {
+            if ( SharedMeshInput.RefCount <= 0 )
+            {
+                if ( SharedMeshInput.NodeId >= 0 )
+                    FHoudiniApi::DeleteNode( FHoudiniEngine::Get().GetSession(), SharedMeshInput.NodeId );
+
+                SharedMeshInputs.Remove( StaticMesh );
+            }
+            else
+            {
+                SharedMeshInput.MeshKey = 0;
+            }
+
+            return false;
+        }
+
+        SharedMeshInput.MeshKey = MeshKey;
+    }
+
+    const HAPI_NodeId SharedNodeId = SharedMeshInput.NodeId;
+
+    // Each input references the shared node through its own object merge, which carries its transform.
+    HAPI_NodeId NodeId = -1;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
+        FHoudiniEngine::Get().GetSession(), -1,
+        "SOP/object_merge", nullptr, true, &NodeId ), false );
+
+    auto SetObjectMergeParms = [&]()
+    {
+        HAPI_StringHandle SharedNodePathHandle;
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetNodePath(
+            FHoudiniEngine::Get().GetSession(), SharedNodeId, -1, &SharedNodePathHandle ), false );
+
+        FString SharedNodePath;
+        FHoudiniEngineString( SharedNodePathHandle ).ToFString( SharedNodePath );
+
+        HAPI_ParmId ParmId = -1;
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmIdFromName(
+            FHoudiniEngine::Get().GetSession(), NodeId,
+            HAPI_UNREAL_PARAM_OBJECT_MERGE_PATH, &ParmId ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmStringValue(
+            FHoudiniEngine::Get().GetSession(), NodeId,
+            TCHAR_TO_UTF8( *SharedNodePath ), ParmId, 0 ), false );
+
+        // The shared geometry is copied as is, the object merge's own object transform is applied downstream.
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmIntValue(
+            FHoudiniEngine::Get().GetSession(), NodeId,
+            HAPI_UNREAL_PARAM_OBJECT_MERGE_TRANSFORM_TYPE, 0, 0 ), false );
+
+        return true;
+    };
+
+    if ( !SetObjectMergeParms() )
+    {
+        FHoudiniApi::DeleteNode( FHoudiniEngine::Get().GetSession(), NodeId );
+        return false;
+    }
+
+    // The object merge only references the shared node once it points to it.
+    SharedMeshInput.RefCount++;
+    FHoudiniEngine::Get().GetSharedMeshInputReferences().Add( NodeId, StaticMesh );
+    ObjectMergeNodeId = NodeId;
+
+    return true;
+
+#else
+
+    return false;
+
+#endif
+}
+
+void
+FHoudiniEngineUtils::InvalidateSharedInputNodeForData( UStaticMesh * StaticMesh )
+{
+    FHoudiniEngineSharedMeshInput * SharedMeshInput = FHoudiniEngine::Get().GetSharedMeshInputs().Find( StaticMesh );
+    if ( SharedMeshInput )
+        SharedMeshInput->MeshKey = 0;
+}
+
+void
+FHoudiniEngineUtils::HapiReleaseSharedInputNode( HAPI_NodeId ObjectMergeNodeId )
+{
+    if ( !FHoudiniEngine::IsInitialized() )
+        return;
+
+    TWeakObjectPtr< UStaticMesh > StaticMesh;
+    if ( !FHoudiniEngine::Get().GetSharedMeshInputReferences().RemoveAndCopyValue( ObjectMergeNodeId, StaticMesh ) )
+        return;
+
+    TMap< TWeakObjectPtr< UStaticMesh >, FHoudiniEngineSharedMeshInput > & SharedMeshInputs =
+        FHoudiniEngine::Get().GetSharedMeshInputs();
+
+    FHoudiniEngineSharedMeshInput * SharedMeshInput = SharedMeshInputs.Find( StaticMesh );
+    if ( !SharedMeshInput )
+        return;
+
+    // The last input referencing the mesh destroys its node.
+    if ( --SharedMeshInput->RefCount <= 0 )
+    {
+        if ( SharedMeshInput->NodeId >= 0 )
+            FHoudiniApi::DeleteNode( FHoudiniEngine::Get().GetSession(), SharedMeshInput->NodeId );
+
+        SharedMeshInputs.Remove( StaticMesh );
+    }
+}
+
+bool
+FHoudiniEngineUtils::HapiCreateInputNodeForData(
+    HAPI_NodeId HostAssetId,
+    TArray< FHoudiniAssetInputOutlinerMesh > & OutlinerMeshArray,
+    HAPI_NodeId & ConnectedAssetId,
+    const float& SplineResolution)
+{
+    if ( OutlinerMeshArray.Num() <= 0 )
+        return false;
+
+    // Upload all the entries to a new merge node.
+    ConnectedAssetId = -1;
+    for ( auto & OutlinerMesh : OutlinerMeshArray )
+        OutlinerMesh.AssetId = -1;
+
+    TArray< HAPI_NodeId > ConnectedNodeIds;
+    return FHoudiniEngineUtils::HapiUpdateInputNodeForData(
+        HostAssetId, OutlinerMeshArray, ConnectedAssetId, ConnectedNodeIds, SplineResolution );
+}
+
+bool
+FHoudiniEngineUtils::HapiUpdateInputNodeForData(
+    HAPI_NodeId HostAssetId,
+    TArray< FHoudiniAssetInputOutlinerMesh > & OutlinerMeshArray,
+    HAPI_NodeId & ConnectedAssetId,
+    TArray< HAPI_NodeId > & InOutConnectedNodeIds,
+    const float & SplineResolution )
+{
+    if ( OutlinerMeshArray.Num() <= 0 )
+        return false;
 
-        // We can now set vertex list.
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetVertexList(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, StaticMeshIndices.GetData(), 0, StaticMeshIndices.Num() ), false );
+    // Create the merge SOP asset the first time. This will be our "ConnectedAssetId".
+    if ( !FHoudiniEngineUtils::IsHoudiniAssetValid( ConnectedAssetId ) )
+    {
+        InOutConnectedNodeIds.Empty();
 
-        // We need to generate array of face counts.
-        TArray< int32 > StaticMeshFaceCounts;
-        StaticMeshFaceCounts.Init( 3, Part.faceCount );
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetFaceCounts(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, StaticMeshFaceCounts.GetData(), 0, StaticMeshFaceCounts.Num() ), false );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
+            FHoudiniEngine::Get().GetSession(), -1,
+            "SOP/merge", nullptr, true, &ConnectedAssetId ), false );
     }
 
-    // Marshall face material indices.
-    if ( RawMesh.FaceMaterialIndices.Num() > 0 )
+    int32 UploadedCount = 0;
+    for ( auto & OutlinerMesh : OutlinerMeshArray )
     {
-        // Create list of materials, one for each face.
-        TArray< char * > StaticMeshFaceMaterials;
-        FHoudiniEngineUtils::CreateFaceMaterialArray(
-            StaticMesh->StaticMaterials, RawMesh.FaceMaterialIndices,
-            StaticMeshFaceMaterials );
+        // Entries keep their input node unless their mesh changed, or the mesh can't be cached.
+        uint32 MeshKey = 0;
+        if ( OutlinerMesh.StaticMesh != nullptr )
+            MeshKey = FHoudiniEngineUtils::GetStaticMeshInputKey( OutlinerMesh.StaticMesh, OutlinerMesh.StaticMeshComponent );
 
-        // Get name of attribute used for marshalling materials.
-        std::string MarshallingAttributeName = HAPI_UNREAL_ATTRIB_MATERIAL;
-        if ( HoudiniRuntimeSettings && !HoudiniRuntimeSettings->MarshallingAttributeMaterial.IsEmpty() )
-            FHoudiniEngineUtils::ConvertUnrealString(
-                HoudiniRuntimeSettings->MarshallingAttributeMaterial, MarshallingAttributeName );
+        if ( OutlinerMesh.AssetId >= 0 )
+        {
+            if ( !OutlinerMesh.StaticMesh || ( MeshKey != 0 && MeshKey == OutlinerMesh.MeshKey ) )
+                continue;
 
-        // Create attribute for materials.
-        HAPI_AttributeInfo AttributeInfoMaterial;
-        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoMaterial );
-        AttributeInfoMaterial.count = RawMesh.FaceMaterialIndices.Num();
-        AttributeInfoMaterial.tupleSize = 1;
-        AttributeInfoMaterial.exists = true;
-        AttributeInfoMaterial.owner = HAPI_ATTROWNER_PRIM;
-        AttributeInfoMaterial.storage = HAPI_STORAGETYPE_STRING;
-        AttributeInfoMaterial.originalOwner = HAPI_ATTROWNER_INVALID;
+            const int32 ConnectedIdx = InOutConnectedNodeIds.Find( OutlinerMesh.AssetId );
+            if ( ConnectedIdx != INDEX_NONE )
+                InOutConnectedNodeIds[ ConnectedIdx ] = -1;
 
-        bool bAttributeError = false;
+            FHoudiniEngineUtils::DestroyHoudiniAsset( OutlinerMesh.AssetId );
+            OutlinerMesh.AssetId = -1;
+        }
+
+        bool bInputCreated = false;
 
-        if ( FHoudiniApi::AddAttribute( FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
-            MarshallingAttributeName.c_str(), &AttributeInfoMaterial ) != HAPI_RESULT_SUCCESS )
+        if (OutlinerMesh.StaticMesh != nullptr)
         {
-            bAttributeError = true;
-        }
+            // Reference the mesh's shared input node, or create an Input Node for Mesh Data if it can't be shared.
+            bInputCreated = HapiCreateSharedInputNodeForData(
+                ConnectedAssetId,
+                OutlinerMesh.StaticMesh,
+                OutlinerMesh.StaticMeshComponent,
+                OutlinerMesh.AssetId );
 
-        if ( FHoudiniApi::SetAttributeStringData(
-            FHoudiniEngine::Get().GetSession(),
-            DisplayGeoInfo.nodeId, 0, MarshallingAttributeName.c_str(), &AttributeInfoMaterial,
-            (const char **) StaticMeshFaceMaterials.GetData(), 0,
-            StaticMeshFaceMaterials.Num() ) != HAPI_RESULT_SUCCESS )
+            if ( !bInputCreated )
+            {
+                bInputCreated = HapiCreateInputNodeForData(
+                    ConnectedAssetId,
+                    OutlinerMesh.StaticMesh,
+                    OutlinerMesh.AssetId,
+                    OutlinerMesh.StaticMeshComponent );
+            }
+        }
+        else if (OutlinerMesh.SplineComponent != nullptr)
         {
-            bAttributeError = true;
+            // Creating an input node for spline data
+            bInputCreated = HapiCreateInputNodeForData(
+                ConnectedAssetId,
+                OutlinerMesh.SplineComponent,
+                OutlinerMesh.AssetId,
+                OutlinerMesh,
+                SplineResolution);
         }
 
-        // Delete material names.
-        FHoudiniEngineUtils::DeleteFaceMaterialArray( StaticMeshFaceMaterials );
+        OutlinerMesh.MeshKey = bInputCreated ? MeshKey : 0;
 
-        if ( bAttributeError )
+        if ( !bInputCreated )
         {
-            check( 0 );
-            return false;
+            OutlinerMesh.AssetId = -1;
+            continue;
         }
+
+        UploadedCount++;
+
+        // Updating the Transform
+        HAPI_TransformEuler HapiTransform;
+        FHoudiniEngineUtils::TranslateUnrealTransform( OutlinerMesh.ComponentTransform, HapiTransform );
+
+        HAPI_NodeInfo LocalAssetNodeInfo;
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetNodeInfo(
+            FHoudiniEngine::Get().GetSession(), OutlinerMesh.AssetId,
+            &LocalAssetNodeInfo ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetObjectTransform(
+            FHoudiniEngine::Get().GetSession(),
+            LocalAssetNodeInfo.parentId, &HapiTransform ), false );
     }
 
-    // Marshall face smoothing masks.
-    if ( RawMesh.FaceSmoothingMasks.Num() > 0 )
+    TArray< HAPI_NodeId > ConnectedNodeIds;
+    for ( const auto & OutlinerMesh : OutlinerMeshArray )
     {
-        // Get name of attribute used for marshalling face smoothing masks.
-        std::string MarshallingAttributeName = HAPI_UNREAL_ATTRIB_FACE_SMOOTHING_MASK;
-        if ( HoudiniRuntimeSettings && !HoudiniRuntimeSettings->MarshallingAttributeMaterial.IsEmpty() )
-        {
-            FHoudiniEngineUtils::ConvertUnrealString(
-                HoudiniRuntimeSettings->MarshallingAttributeFaceSmoothingMask,
-                MarshallingAttributeName );
-        }
+        if ( OutlinerMesh.AssetId >= 0 )
+            ConnectedNodeIds.Add( OutlinerMesh.AssetId );
+    }
 
-        HAPI_AttributeInfo AttributeInfoSmoothingMasks;
-        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoSmoothingMasks );
-        AttributeInfoSmoothingMasks.count = RawMesh.FaceSmoothingMasks.Num();
-        AttributeInfoSmoothingMasks.tupleSize = 1;
-        AttributeInfoSmoothingMasks.exists = true;
-        AttributeInfoSmoothingMasks.owner = HAPI_ATTROWNER_PRIM;
-        AttributeInfoSmoothingMasks.storage = HAPI_STORAGETYPE_INT;
-        AttributeInfoSmoothingMasks.originalOwner = HAPI_ATTROWNER_INVALID;
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, MarshallingAttributeName.c_str(), &AttributeInfoSmoothingMasks ), false );
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeIntData(
-            FHoudiniEngine::Get().GetSession(),
-            DisplayGeoInfo.nodeId, 0, MarshallingAttributeName.c_str(), &AttributeInfoSmoothingMasks,
-            (const int32 *) RawMesh.FaceSmoothingMasks.GetData(), 0, RawMesh.FaceSmoothingMasks.Num() ), false );
+    // Destroy the input nodes of the entries that have been removed.
+    for ( HAPI_NodeId NodeId : InOutConnectedNodeIds )
+    {
+        if ( NodeId >= 0 && !ConnectedNodeIds.Contains( NodeId ) )
+            FHoudiniEngineUtils::DestroyHoudiniAsset( NodeId );
     }
 
-    // Marshall lightmap resolution.
-    if ( StaticMesh->LightMapResolution != GeneratedLightMapResolution )
+    // Only rewire the merge node inputs whose node changed.
+    for ( int32 InputIdx = 0; InputIdx < ConnectedNodeIds.Num(); ++InputIdx )
     {
-        std::string MarshallingAttributeName = HAPI_UNREAL_ATTRIB_LIGHTMAP_RESOLUTION;
-        if ( HoudiniRuntimeSettings && !HoudiniRuntimeSettings->MarshallingAttributeLightmapResolution.IsEmpty() )
-        {
-            FHoudiniEngineUtils::ConvertUnrealString(
-                HoudiniRuntimeSettings->MarshallingAttributeLightmapResolution,
-                MarshallingAttributeName );
-        }
+        if ( InOutConnectedNodeIds.IsValidIndex( InputIdx ) && InOutConnectedNodeIds[ InputIdx ] == ConnectedNodeIds[ InputIdx ] )
+            continue;
 
-        TArray< int32 > LightMapResolutions;
-        LightMapResolutions.Add( StaticMesh->LightMapResolution );
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
+            FHoudiniEngine::Get().GetSession(), ConnectedAssetId, InputIdx,
+            ConnectedNodeIds[ InputIdx ] ), false );
+    }
 
-        HAPI_AttributeInfo AttributeInfoLightMapResolution;
-        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoLightMapResolution );
-        AttributeInfoLightMapResolution.count = LightMapResolutions.Num();
-        AttributeInfoLightMapResolution.tupleSize = 1;
-        AttributeInfoLightMapResolution.exists = true;
-        AttributeInfoLightMapResolution.owner = HAPI_ATTROWNER_DETAIL;
-        AttributeInfoLightMapResolution.storage = HAPI_STORAGETYPE_INT;
-        AttributeInfoLightMapResolution.originalOwner = HAPI_ATTROWNER_INVALID;
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, MarshallingAttributeName.c_str(), &AttributeInfoLightMapResolution ), false );
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeIntData(
-            FHoudiniEngine::Get().GetSession(),
-            DisplayGeoInfo.nodeId, 0, MarshallingAttributeName.c_str(), &AttributeInfoLightMapResolution,
-            (const int32 *) LightMapResolutions.GetData(), 0, LightMapResolutions.Num() ), false );
+    for ( int32 InputIdx = ConnectedNodeIds.Num(); InputIdx < InOutConnectedNodeIds.Num(); ++InputIdx )
+    {
+        FHoudiniApi::DisconnectNodeInput(
+            FHoudiniEngine::Get().GetSession(), ConnectedAssetId, InputIdx );
     }
 
-    if ( !HoudiniRuntimeSettings->MarshallingAttributeInputMeshName.IsEmpty() )
+    InOutConnectedNodeIds = ConnectedNodeIds;
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "World outliner input: uploaded %d of %d entries." ),
+        UploadedCount, OutlinerMeshArray.Num() );
+
+    return true;
+}
+
+bool
+FHoudiniEngineUtils::IsInstancedInputMesh( const FHoudiniAssetInputOutlinerMesh & OutlinerMesh )
+{
+    if ( !OutlinerMesh.StaticMesh )
+        return false;
+
+    // Attribute data components upload their own data with the mesh, these can't share an instanced mesh.
+    UStaticMeshComponent * StaticMeshComponent = OutlinerMesh.StaticMeshComponent;
+    return !( StaticMeshComponent && StaticMeshComponent->GetOwner()
+        && StaticMeshComponent->GetOwner()->FindComponentByClass< UHoudiniAttributeDataComponent >() );
+}
+
+bool
+FHoudiniEngineUtils::HapiSetInstancedInputPoints(
+    HAPI_NodeId PointsNodeId,
+    const TArray< FHoudiniAssetInputOutlinerMesh > & OutlinerMeshArray,
+    TArray< UStaticMesh * > & OutInstancedMeshes )
+{
+#if WITH_EDITOR
+
+    // Gather the unique meshes, and the transform and mesh index of each instance.
+    OutInstancedMeshes.Empty();
+    TArray< int32 > InstanceMeshIndices;
+    TArray< HAPI_Transform > InstanceTransforms;
+    for ( const auto & OutlinerMesh : OutlinerMeshArray )
     {
-        // Create primitive attribute with mesh asset path
+        if ( !IsInstancedInputMesh( OutlinerMesh ) )
+            continue;
 
-        FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>( "AssetRegistry" );
-        const FString MeshAssetPath = StaticMesh->GetPathName();
-        std::string MeshAssetPathCStr = TCHAR_TO_ANSI( *MeshAssetPath );
-        const char* MeshAssetPathRaw = MeshAssetPathCStr.c_str();
-        TArray<const char*> PrimitiveAttrs;
-        PrimitiveAttrs.AddUninitialized( Part.faceCount );
-        for ( int32 Ix = 0; Ix < Part.faceCount; ++Ix )
-        {
-            PrimitiveAttrs[ Ix ] = MeshAssetPathRaw;
-        }
+        InstanceMeshIndices.Add( OutInstancedMeshes.AddUnique( OutlinerMesh.StaticMesh ) );
 
-        std::string MarshallingAttributeName;
-        FHoudiniEngineUtils::ConvertUnrealString(
-            HoudiniRuntimeSettings->MarshallingAttributeInputMeshName,
-            MarshallingAttributeName );
-        
-        HAPI_AttributeInfo AttributeInfo {};
-        AttributeInfo.count = Part.faceCount;
-        AttributeInfo.tupleSize = 1;
+        HAPI_Transform & InstanceTransform = InstanceTransforms[ InstanceTransforms.AddUninitialized() ];
+        FHoudiniEngineUtils::TranslateUnrealTransform( OutlinerMesh.ComponentTransform, InstanceTransform );
+    }
+
+    HAPI_GeoInfo DisplayGeoInfo;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetDisplayGeoInfo(
+        FHoudiniEngine::Get().GetSession(), PointsNodeId, &DisplayGeoInfo ), false );
+
+    const int32 NumInstances = InstanceMeshIndices.Num();
+
+    HAPI_PartInfo Part;
+    FMemory::Memzero< HAPI_PartInfo >( Part );
+    Part.id = 0;
+    Part.nameSH = 0;
+    Part.type = HAPI_PARTTYPE_MESH;
+    Part.faceCount = 0;
+    Part.vertexCount = 0;
+    Part.pointCount = NumInstances;
+
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetPartInfo(
+        FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0, &Part ), false );
+
+    // Position, orient, scale and pivot of each instance, already converted to Houdini's space.
+    TArray< float > Positions;
+    TArray< float > Orients;
+    TArray< float > Scales;
+    TArray< float > Pivots;
+    Positions.SetNumUninitialized( NumInstances * 3 );
+    Orients.SetNumUninitialized( NumInstances * 4 );
+    Scales.SetNumUninitialized( NumInstances * 3 );
+    Pivots.SetNumZeroed( NumInstances * 3 );
+
+    for ( int32 InstanceIdx = 0; InstanceIdx < NumInstances; ++InstanceIdx )
+    {
+        const HAPI_Transform & InstanceTransform = InstanceTransforms[ InstanceIdx ];
+        FMemory::Memcpy( &Positions[ InstanceIdx * 3 ], InstanceTransform.position, 3 * sizeof( float ) );
+        FMemory::Memcpy( &Orients[ InstanceIdx * 4 ], InstanceTransform.rotationQuaternion, 4 * sizeof( float ) );
+        FMemory::Memcpy( &Scales[ InstanceIdx * 3 ], InstanceTransform.scale, 3 * sizeof( float ) );
+    }
+
+    auto AddPointFloatAttribute = [ & ]( const char * AttributeName, int32 TupleSize, const TArray< float > & Values )
+    {
+        HAPI_AttributeInfo AttributeInfo;
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
+        AttributeInfo.count = NumInstances;
+        AttributeInfo.tupleSize = TupleSize;
         AttributeInfo.exists = true;
-        AttributeInfo.owner = HAPI_ATTROWNER_PRIM;
-        AttributeInfo.storage = HAPI_STORAGETYPE_STRING;
+        AttributeInfo.owner = HAPI_ATTROWNER_POINT;
+        AttributeInfo.storage = HAPI_STORAGETYPE_FLOAT;
         AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
 
         HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
-            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId,
-            0, MarshallingAttributeName.c_str(), &AttributeInfo ), false );
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+            AttributeName, &AttributeInfo ), false );
 
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeStringData(
-            FHoudiniEngine::Get().GetSession(),
-            DisplayGeoInfo.nodeId, 0, MarshallingAttributeName.c_str(), &AttributeInfo,
-            PrimitiveAttrs.GetData(), 0, PrimitiveAttrs.Num() ), false );
-    }
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+            AttributeName, &AttributeInfo, Values.GetData(), 0, AttributeInfo.count ), false );
 
-    // Check if we have vertex attribute data to add
-    if ( StaticMeshComponent && StaticMeshComponent->GetOwner() )
+        return true;
+    };
+
+    if ( !AddPointFloatAttribute( HAPI_UNREAL_ATTRIB_POSITION, 3, Positions )
+        || !AddPointFloatAttribute( HAPI_UNREAL_ATTRIB_ORIENT, 4, Orients )
+        || !AddPointFloatAttribute( HAPI_UNREAL_ATTRIB_SCALE, 3, Scales )
+        || !AddPointFloatAttribute( HAPI_UNREAL_ATTRIB_PIVOT, 3, Pivots ) )
+        return false;
+
+    // Index of the instanced mesh of each point.
     {
-        if ( UHoudiniAttributeDataComponent* DataComponent = StaticMeshComponent->GetOwner()->FindComponentByClass<UHoudiniAttributeDataComponent>() )
-        {
-            bool bSuccess = DataComponent->Upload( DisplayGeoInfo.nodeId, StaticMeshComponent );
-            if ( !bSuccess )
-            {
-                HOUDINI_LOG_ERROR( TEXT( "Upload of attribute data for %s failed" ), *StaticMeshComponent->GetOwner()->GetName() );
-            }
-        }
+        HAPI_AttributeInfo AttributeInfoMeshIndex;
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfoMeshIndex );
+        AttributeInfoMeshIndex.count = NumInstances;
+        AttributeInfoMeshIndex.tupleSize = 1;
+        AttributeInfoMeshIndex.exists = true;
+        AttributeInfoMeshIndex.owner = HAPI_ATTROWNER_POINT;
+        AttributeInfoMeshIndex.storage = HAPI_STORAGETYPE_INT;
+        AttributeInfoMeshIndex.originalOwner = HAPI_ATTROWNER_INVALID;
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::AddAttribute(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+            HAPI_UNREAL_ATTRIB_INPUT_MESH_INDEX, &AttributeInfoMeshIndex ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetAttributeIntData(
+            FHoudiniEngine::Get().GetSession(), DisplayGeoInfo.nodeId, 0,
+            HAPI_UNREAL_ATTRIB_INPUT_MESH_INDEX, &AttributeInfoMeshIndex,
+            InstanceMeshIndices.GetData(), 0, AttributeInfoMeshIndex.count ), false );
     }
 
     // Commit the geo.
@@ -3744,44 +5051,110 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
 }
 
 bool
-FHoudiniEngineUtils::HapiCreateInputNodeForData(
+FHoudiniEngineUtils::HapiCreateInstancedInputNodeForData(
     HAPI_NodeId HostAssetId,
     TArray< FHoudiniAssetInputOutlinerMesh > & OutlinerMeshArray,
     HAPI_NodeId & ConnectedAssetId,
-    const float& SplineResolution)
+    TArray< HAPI_NodeId > & OutCreatedNodeIds,
+    HAPI_NodeId & OutPointsNodeId,
+    const float & SplineResolution )
 {
-    if ( OutlinerMeshArray.Num() <= 0 )
+#if WITH_EDITOR
+
+    if ( OutlinerMeshArray.Num() <= 0 || !FHoudiniEngineUtils::IsHoudiniAssetValid( HostAssetId ) )
         return false;
 
-    // Create the merge SOP asset. This will be our "ConnectedAssetId".
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
-        FHoudiniEngine::Get().GetSession(), -1,
-        "SOP/merge", nullptr, true, &ConnectedAssetId ), false );
+    // Create the merge SOP asset. This will be our "ConnectedAssetId".
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
+        FHoudiniEngine::Get().GetSession(), -1,
+        "SOP/merge", nullptr, true, &ConnectedAssetId ), false );
+
+    int32 MergeInputIdx = 0;
+    TArray< UStaticMesh * > InstancedMeshes;
+    if ( OutlinerMeshArray.ContainsByPredicate( &FHoudiniEngineUtils::IsInstancedInputMesh ) )
+    {
+        // Create the input node for the instance points.
+        HAPI_NodeId PointsNodeId = -1;
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateInputNode(
+            FHoudiniEngine::Get().GetSession(), &PointsNodeId, nullptr ), false );
+
+        OutCreatedNodeIds.Add( PointsNodeId );
+
+        if ( !HapiSetInstancedInputPoints( PointsNodeId, OutlinerMeshArray, InstancedMeshes ) )
+            return false;
+
+        OutPointsNodeId = PointsNodeId;
+
+        // Each unique mesh is uploaded once, and copied as packed primitives to the points using it.
+        for ( int32 MeshIdx = 0; MeshIdx < InstancedMeshes.Num(); ++MeshIdx )
+        {
+            UStaticMesh * InstancedMesh = InstancedMeshes[ MeshIdx ];
+
+            HAPI_NodeId MeshNodeId = -1;
+            if ( !HapiCreateSharedInputNodeForData( ConnectedAssetId, InstancedMesh, nullptr, MeshNodeId )
+                && !HapiCreateInputNodeForData( ConnectedAssetId, InstancedMesh, MeshNodeId, nullptr ) )
+            {
+                HOUDINI_LOG_WARNING( TEXT( "Error creating instanced mesh input for %s" ), *InstancedMesh->GetName() );
+                continue;
+            }
+
+            OutCreatedNodeIds.Add( MeshNodeId );
+
+            HAPI_NodeId CopyNodeId = -1;
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
+                FHoudiniEngine::Get().GetSession(), -1,
+                "SOP/copytopoints", nullptr, true, &CopyNodeId ), false );
+
+            OutCreatedNodeIds.Add( CopyNodeId );
+
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
+                FHoudiniEngine::Get().GetSession(), CopyNodeId, 0, MeshNodeId ), false );
+
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
+                FHoudiniEngine::Get().GetSession(), CopyNodeId, 1, PointsNodeId ), false );
+
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmIntValue(
+                FHoudiniEngine::Get().GetSession(), CopyNodeId,
+                HAPI_UNREAL_PARAM_COPY_TO_POINTS_PACK, 0, 1 ), false );
+
+            // Only copy to the points referencing this mesh.
+            FString TargetGroup = FString::Printf( TEXT( "@%s==%d" ), TEXT( HAPI_UNREAL_ATTRIB_INPUT_MESH_INDEX ), MeshIdx );
+
+            HAPI_ParmId ParmId = -1;
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmIdFromName(
+                FHoudiniEngine::Get().GetSession(), CopyNodeId,
+                HAPI_UNREAL_PARAM_COPY_TO_POINTS_TARGET_GROUP, &ParmId ), false );
+
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetParmStringValue(
+                FHoudiniEngine::Get().GetSession(), CopyNodeId,
+                TCHAR_TO_UTF8( *TargetGroup ), ParmId, 0 ), false );
+
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
+                FHoudiniEngine::Get().GetSession(), ConnectedAssetId, MergeInputIdx++,
+                CopyNodeId ), false );
+        }
+    }
 
-    for ( int32 InputIdx = 0; InputIdx < OutlinerMeshArray.Num(); ++InputIdx )
+    // Splines are uploaded as curves, and meshes with attribute data as separate inputs, like in the per-mesh path.
+    int32 NumInstances = 0;
+    for ( auto & OutlinerMesh : OutlinerMeshArray )
     {
-        auto & OutlinerMesh = OutlinerMeshArray[ InputIdx ];
+        if ( IsInstancedInputMesh( OutlinerMesh ) )
+        {
+            NumInstances++;
+            continue;
+        }
 
         bool bInputCreated = false;
-
-        if (OutlinerMesh.StaticMesh != nullptr)
+        if ( OutlinerMesh.StaticMesh )
         {
-            // Creating an Input Node for Mesh Data
             bInputCreated = HapiCreateInputNodeForData(
-                ConnectedAssetId,
-                OutlinerMesh.StaticMesh,
-                OutlinerMesh.AssetId,
-                OutlinerMesh.StaticMeshComponent );
+                ConnectedAssetId, OutlinerMesh.StaticMesh, OutlinerMesh.AssetId, OutlinerMesh.StaticMeshComponent );
         }
-        else if (OutlinerMesh.SplineComponent != nullptr)
+        else if ( OutlinerMesh.SplineComponent )
         {
-            // Creating an input node for spline data
             bInputCreated = HapiCreateInputNodeForData(
-                ConnectedAssetId,
-                OutlinerMesh.SplineComponent,
-                OutlinerMesh.AssetId,
-                OutlinerMesh,
-                SplineResolution);
+                ConnectedAssetId, OutlinerMesh.SplineComponent, OutlinerMesh.AssetId, OutlinerMesh, SplineResolution );
         }
 
         if ( !bInputCreated )
@@ -3790,12 +5163,8 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
             continue;
         }
 
-        // Now we can connect the input node to the asset node.
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
-            FHoudiniEngine::Get().GetSession(), ConnectedAssetId, InputIdx,
-            OutlinerMesh.AssetId), false);
-        
-        // Updating the Transform
+        OutCreatedNodeIds.Add( OutlinerMesh.AssetId );
+
         HAPI_TransformEuler HapiTransform;
         FHoudiniEngineUtils::TranslateUnrealTransform( OutlinerMesh.ComponentTransform, HapiTransform );
 
@@ -3807,43 +5176,109 @@ FHoudiniEngineUtils::HapiCreateInputNodeForData(
         HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::SetObjectTransform(
             FHoudiniEngine::Get().GetSession(),
             LocalAssetNodeInfo.parentId, &HapiTransform ), false );
+
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
+            FHoudiniEngine::Get().GetSession(), ConnectedAssetId, MergeInputIdx++,
+            OutlinerMesh.AssetId ), false );
     }
 
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "World outliner input: %d instances of %d meshes." ),
+        NumInstances, InstancedMeshes.Num() );
+
+#endif
+
     return true;
 }
 
 bool 
-FHoudiniEngineUtils::HapiCreateInputNodeForData( HAPI_NodeId HostAssetId, TArray<UObject *>& InputObjects, HAPI_NodeId & ConnectedAssetId, TArray< HAPI_NodeId >& OutCreatedNodeIds )
+FHoudiniEngineUtils::HapiCreateInputNodeForData(
+    HAPI_NodeId HostAssetId, TArray<UObject *>& InputObjects, HAPI_NodeId & ConnectedAssetId,
+    TArray< HAPI_NodeId >& OutCreatedNodeIds, TArray< uint32 >& InOutMeshKeys )
 {
     if ( ensure( InputObjects.Num() ) )
     {
         // TODO: No need to merge if there is only one input object if ( InputObjects.Num() == 1 )
 
         // Create the merge SOP asset. This will be our "ConnectedAssetId".
-        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
-            FHoudiniEngine::Get().GetSession(), -1,
-            "SOP/merge", nullptr, true, &ConnectedAssetId ), false );
+        // If it already exists, the input nodes of the previous upload are reused.
+        if ( !FHoudiniEngineUtils::IsHoudiniAssetValid( ConnectedAssetId ) )
+        {
+            // The input nodes of the previous upload can outlive their merge node, release them first.
+            for ( HAPI_NodeId CreatedNodeId : OutCreatedNodeIds )
+            {
+                if ( CreatedNodeId >= 0 )
+                    FHoudiniEngineUtils::DestroyHoudiniAsset( CreatedNodeId );
+            }
+
+            OutCreatedNodeIds.Empty();
+            InOutMeshKeys.Empty();
+
+            HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::CreateNode(
+                FHoudiniEngine::Get().GetSession(), -1,
+                "SOP/merge", nullptr, true, &ConnectedAssetId ), false );
+        }
+
+        // Destroy the input nodes of the objects that were removed.
+        for ( int32 InputIdx = InputObjects.Num(); InputIdx < OutCreatedNodeIds.Num(); ++InputIdx )
+        {
+            if ( OutCreatedNodeIds[ InputIdx ] >= 0 )
+                FHoudiniEngineUtils::DestroyHoudiniAsset( OutCreatedNodeIds[ InputIdx ] );
+        }
+
+        // Node ids and mesh keys are stored per input object.
+        while ( OutCreatedNodeIds.Num() < InputObjects.Num() )
+            OutCreatedNodeIds.Add( -1 );
+        OutCreatedNodeIds.SetNum( InputObjects.Num() );
+
+        while ( InOutMeshKeys.Num() < InputObjects.Num() )
+            InOutMeshKeys.Add( 0 );
+        InOutMeshKeys.SetNum( InputObjects.Num() );
 
         for ( int32 InputIdx = 0; InputIdx < InputObjects.Num(); ++InputIdx )
         {
-            if ( UStaticMesh* InputStaticMesh = Cast< UStaticMesh >( InputObjects[ InputIdx ] ) )
+            HAPI_NodeId & MeshAssetNodeId = OutCreatedNodeIds[ InputIdx ];
+
+            UStaticMesh* InputStaticMesh = Cast< UStaticMesh >( InputObjects[ InputIdx ] );
+            if ( !InputStaticMesh )
             {
-                HAPI_NodeId MeshAssetNodeId = -1;
-                // Creating an Input Node for Mesh Data
-                bool bInputCreated = HapiCreateInputNodeForData( ConnectedAssetId, InputStaticMesh, MeshAssetNodeId, nullptr );
-                if ( !bInputCreated )
-                {
-                    HOUDINI_LOG_WARNING( TEXT( "Error creating input index %d on %d" ), InputIdx, ConnectedAssetId );
-                }
                 if ( MeshAssetNodeId >= 0 )
-                {
-                    OutCreatedNodeIds.Add( MeshAssetNodeId );
+                    FHoudiniEngineUtils::DestroyHoudiniAsset( MeshAssetNodeId );
 
-                    // Now we can connect the input node to the asset node.
-                    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
-                        FHoudiniEngine::Get().GetSession(), ConnectedAssetId, InputIdx,
-                        MeshAssetNodeId ), false );
-                }
+                MeshAssetNodeId = -1;
+                InOutMeshKeys[ InputIdx ] = 0;
+                continue;
+            }
+
+            // Meshes whose content and export settings didn't change keep their uploaded geometry.
+            const uint32 MeshKey = FHoudiniEngineUtils::GetStaticMeshInputKey( InputStaticMesh, nullptr );
+            if ( MeshAssetNodeId >= 0 && MeshKey != 0 && MeshKey == InOutMeshKeys[ InputIdx ] )
+                continue;
+
+            // Release the previous mesh before referencing the new one.
+            if ( MeshAssetNodeId >= 0 )
+                FHoudiniEngineUtils::DestroyHoudiniAsset( MeshAssetNodeId );
+
+            MeshAssetNodeId = -1;
+
+            // Reference the mesh's shared input node, or create an Input Node for Mesh Data if it can't be shared.
+            bool bInputCreated = HapiCreateSharedInputNodeForData( ConnectedAssetId, InputStaticMesh, nullptr, MeshAssetNodeId );
+            if ( !bInputCreated )
+                bInputCreated = HapiCreateInputNodeForData( ConnectedAssetId, InputStaticMesh, MeshAssetNodeId, nullptr );
+
+            if ( !bInputCreated )
+            {
+                HOUDINI_LOG_WARNING( TEXT( "Error creating input index %d on %d" ), InputIdx, ConnectedAssetId );
+            }
+
+            InOutMeshKeys[ InputIdx ] = bInputCreated ? MeshKey : 0;
+
+            if ( MeshAssetNodeId >= 0 )
+            {
+                // Now we can connect the input node to the asset node.
+                HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::ConnectNodeInput(
+                    FHoudiniEngine::Get().GetSession(), ConnectedAssetId, InputIdx,
+                    MeshAssetNodeId ), false );
             }
         }
     }
@@ -4495,6 +5930,19 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
         HoudiniCookParams.HoudiniCookManager->AddAssignmentMaterial( AssPair.Key, AssPair.Value );
     }
 
+    // Shop names of the materials used by this cook, resolved once per material id.
+    TMap< HAPI_NodeId, FString > MaterialShopNames;
+    auto GetCachedMaterialShopName = [&]( HAPI_NodeId MaterialId ) -> FString
+    {
+        FString * FoundShopName = MaterialShopNames.Find( MaterialId );
+        if ( FoundShopName )
+            return *FoundShopName;
+
+        FString MaterialShopName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
+        FHoudiniEngineUtils::GetUniqueMaterialShopName( AssetId, MaterialId, MaterialShopName );
+        return MaterialShopNames.Add( MaterialId, MaterialShopName );
+    };
+
     UStaticMesh * StaticMesh = nullptr;
     FString MeshName;
     FGuid MeshGuid;
@@ -4607,6 +6055,9 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
             bool bIsCollidable = false;
             bool bIsUCXCollidable = false;
             bool bIsSimpleCollidable = false;
+
+            // Names of the groups that are classified as collision groups, their membership is fetched per part.
+            TArray< FString > CollisionGroupNames;
             
             if ( HoudiniRuntimeSettings )
             {
@@ -4614,6 +6065,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                 for ( int32 GeoGroupNameIdx = 0; GeoGroupNameIdx < ObjectGeoGroupNames.Num(); ++GeoGroupNameIdx )
                 {
                     const FString & GroupName = ObjectGeoGroupNames[ GeoGroupNameIdx ];
+                    bool bIsCollisionGroup = true;
 
                     // UCX and simple collisions need to be checked first as they both start in the same way
                     // as their non UCX/non simple equivalent!
@@ -4659,6 +6111,13 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     {
                         bIsCollidable = true;
                     }
+                    else
+                    {
+                        bIsCollisionGroup = false;
+                    }
+
+                    if ( bIsCollisionGroup )
+                        CollisionGroupNames.Add( GroupName );
                 }
             }
 
@@ -4796,8 +6255,15 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     // Set flag if any of the materials have changed.
                     if ( bMaterialsFound )
                     {
+                        TSet< HAPI_NodeId > CheckedMaterialIds;
                         for ( int32 MaterialFaceIdx = 0; MaterialFaceIdx < FaceMaterialIds.Num(); ++MaterialFaceIdx )
                         {
+                            // Only query each material once.
+                            bool bAlreadyChecked = false;
+                            CheckedMaterialIds.Add( FaceMaterialIds[ MaterialFaceIdx ], &bAlreadyChecked );
+                            if ( bAlreadyChecked )
+                                continue;
+
                             HAPI_MaterialInfo MaterialInfo;
 
                             if ( FHoudiniApi::GetMaterialInfo(
@@ -4953,45 +6419,35 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                     TArray< int32 > AllCollisionFaceIndices;
                     AllCollisionFaceIndices.SetNumZeroed( FaceMaterialIds.Num() );
 
-                    for ( int32 GeoGroupNameIdx = 0; GeoGroupNameIdx < ObjectGeoGroupNames.Num(); ++GeoGroupNameIdx )
+                    // Fetch face membership of all collision groups of this part at once.
+                    TArray< TBitArray<> > CollisionGroupMemberships;
+                    if ( !FHoudiniEngineUtils::HapiGetGroupMembershipBits(
+                        GeoInfo.nodeId, PartInfo, HAPI_GROUPTYPE_PRIM, CollisionGroupNames, CollisionGroupMemberships ) )
                     {
-                        const FString & GroupName = ObjectGeoGroupNames[ GeoGroupNameIdx ];
-
-                        if ( ( !HoudiniRuntimeSettings->RenderedCollisionGroupNamePrefix.IsEmpty() &&
-                                GroupName.StartsWith( HoudiniRuntimeSettings->RenderedCollisionGroupNamePrefix,
-                                ESearchCase::IgnoreCase ) ) ||
-                            ( !HoudiniRuntimeSettings->CollisionGroupNamePrefix.IsEmpty() &&
-                                GroupName.StartsWith( HoudiniRuntimeSettings->CollisionGroupNamePrefix,
-                                ESearchCase::IgnoreCase ) ) ||
-                            ( !HoudiniRuntimeSettings->UCXCollisionGroupNamePrefix.IsEmpty() &&
-                                GroupName.StartsWith( HoudiniRuntimeSettings->UCXCollisionGroupNamePrefix,
-                                ESearchCase::IgnoreCase ) ) ||
-                            ( !HoudiniRuntimeSettings->UCXRenderedCollisionGroupNamePrefix.IsEmpty() &&
-                                GroupName.StartsWith( HoudiniRuntimeSettings->UCXRenderedCollisionGroupNamePrefix,
-                                ESearchCase::IgnoreCase) ) || 
-                            ( !HoudiniRuntimeSettings->SimpleRenderedCollisionGroupNamePrefix.IsEmpty() &&
-                                GroupName.StartsWith( HoudiniRuntimeSettings->SimpleRenderedCollisionGroupNamePrefix,
-                                ESearchCase::IgnoreCase) ) || 
-                            ( !HoudiniRuntimeSettings->SimpleCollisionGroupNamePrefix.IsEmpty() &&
-                                GroupName.StartsWith( HoudiniRuntimeSettings->SimpleCollisionGroupNamePrefix,
-                                ESearchCase::IgnoreCase) ) )
-                        {
-                            // New vertex list just for this group.
-                            TArray< int32 > GroupVertexList;
-                            TArray< int32 > AllFaceList;
+                        HOUDINI_LOG_MESSAGE(
+                            TEXT( "Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] non-fatal error reading group membership" ),
+                            ObjectInfo.nodeId, *ObjectName, GeoId, PartIdx, *PartName );
+                    }
 
-                            // Extract vertex indices for this split.
-                            GroupVertexListCount = FHoudiniEngineUtils::HapiGetVertexListForGroup(
-                                AssetId, ObjectInfo.nodeId, GeoInfo.nodeId, PartInfo.id, GroupName, VertexList, GroupVertexList,
-                                AllCollisionVertexList, AllFaceList, AllCollisionFaceIndices );
+                    for ( int32 CollisionGroupIdx = 0; CollisionGroupIdx < CollisionGroupNames.Num(); ++CollisionGroupIdx )
+                    {
+                        const FString & GroupName = CollisionGroupNames[ CollisionGroupIdx ];
 
-                            if ( GroupVertexListCount > 0 )
-                            {
-                                // If list is not empty, we store it for this group - this will define new mesh.
-                                GroupSplitFaces.Add( GroupName, GroupVertexList );
-                                GroupSplitFaceCounts.Add( GroupName, GroupVertexListCount );
-                                GroupSplitFaceIndices.Add( GroupName, AllFaceList );
-                            }
+                        // New vertex list just for this group.
+                        TArray< int32 > GroupVertexList;
+                        TArray< int32 > AllFaceList;
+
+                        // Extract vertex indices for this split.
+                        GroupVertexListCount = FHoudiniEngineUtils::GetVertexListForGroup(
+                            CollisionGroupMemberships[ CollisionGroupIdx ], VertexList, GroupVertexList,
+                            AllCollisionVertexList, AllFaceList, AllCollisionFaceIndices );
+
+                        if ( GroupVertexListCount > 0 )
+                        {
+                            // If list is not empty, we store it for this group - this will define new mesh.
+                            GroupSplitFaces.Add( GroupName, GroupVertexList );
+                            GroupSplitFaceCounts.Add( GroupName, GroupVertexListCount );
+                            GroupSplitFaceIndices.Add( GroupName, AllFaceList );
                         }
                     }
 
@@ -5822,10 +7278,8 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                             }
                             else
                             {
-                                UMaterialInterface * MaterialInterface = Cast< UMaterialInterface >(
-                                    StaticLoadObject(
-                                        UMaterialInterface::StaticClass(),
-                                        nullptr, *MaterialName, nullptr, LOAD_NoWarn, nullptr ) );
+                                UMaterialInterface * MaterialInterface =
+                                    HoudiniCookParams.HoudiniCookManager->LoadAttributeMaterial( MaterialName );
 
                                 if ( MaterialInterface )
                                 {
@@ -5876,10 +7330,14 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                             {
                                 // Get material id for this face.
                                 HAPI_NodeId MaterialId = FaceMaterialIds[ FaceIdx ];
+
+                                // See if this material has been resolved already.
+                                if ( NativeMaterials.Contains( MaterialId ) )
+                                    continue;
+
                                 UMaterialInterface * Material = MaterialDefault;
 
-                                FString MaterialShopName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
-                                FHoudiniEngineUtils::GetUniqueMaterialShopName( AssetId, MaterialId, MaterialShopName );
+                                FString MaterialShopName = GetCachedMaterialShopName( MaterialId );
                                 UMaterialInterface * const * FoundMaterial = Materials.Find( MaterialShopName );
 
                                 if ( FoundMaterial )
@@ -5892,10 +7350,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                                 if ( ReplacementMaterial )
                                     Material = ReplacementMaterial;
 
-                                // See if this material has been added.
-                                UMaterialInterface * const * FoundNativeMaterial = NativeMaterials.Find( MaterialId );
-                                if ( !FoundNativeMaterial )
-                                    NativeMaterials.Add( MaterialId, Material );
+                                NativeMaterials.Add( MaterialId, Material );
                             }
 
                             for ( int32 FaceIdx = 0; FaceIdx < RawMesh.FaceMaterialIndices.Num(); ++FaceIdx )
@@ -5929,8 +7384,7 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                                 RawMesh.FaceMaterialIndices.SetNumZeroed( FaceCount );
 
                                 // Get id of this single material.
-                                FString MaterialShopName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
-                                FHoudiniEngineUtils::GetUniqueMaterialShopName( AssetId, FaceMaterialIds[ 0 ], MaterialShopName );
+                                FString MaterialShopName = GetCachedMaterialShopName( FaceMaterialIds[ 0 ] );
                                 UMaterialInterface * const * FoundMaterial = Materials.Find( MaterialShopName );
 
                                 if ( FoundMaterial )
@@ -5956,6 +7410,9 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                                 TMap< UMaterialInterface *, int32 > MappedMaterials;
                                 TArray< UMaterialInterface * > MappedMaterialsList;
 
+                                // Material slot resolved for each material id, so faces only need a lookup.
+                                TMap< HAPI_NodeId, int32 > MaterialIdSlots;
+
                                 // Reset Rawmesh material face assignments.
                                 RawMesh.FaceMaterialIndices.SetNumZeroed( SplitGroupFaceIndices.Num() );
 
@@ -5968,10 +7425,16 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
                                     if( SplitFaceIndex >= 0 && SplitFaceIndex < FaceMaterialIds.Num() )
                                         MaterialId = FaceMaterialIds[ SplitFaceIndex ];
 
+                                    int32 const * FoundMaterialIdSlot = MaterialIdSlots.Find( MaterialId );
+                                    if ( FoundMaterialIdSlot )
+                                    {
+                                        RawMesh.FaceMaterialIndices[ FaceIdx ] = *FoundMaterialIdSlot;
+                                        continue;
+                                    }
+
                                     UMaterialInterface * Material = MaterialDefault;
 
-                                    FString MaterialShopName = HAPI_UNREAL_DEFAULT_MATERIAL_NAME;
-                                    FHoudiniEngineUtils::GetUniqueMaterialShopName( AssetId, MaterialId, MaterialShopName );
+                                    FString MaterialShopName = GetCachedMaterialShopName( MaterialId );
                                     UMaterialInterface * const * FoundMaterial = Materials.Find( MaterialShopName );
 
                                     if ( FoundMaterial )
@@ -6001,6 +7464,8 @@ bool FHoudiniEngineUtils::CreateStaticMeshesFromHoudiniAsset(
 
                                         MaterialIndex++;
                                     }
+
+                                    MaterialIdSlots.Add( MaterialId, RawMesh.FaceMaterialIndices[ FaceIdx ] );
                                 }
 
                                 StaticMesh->StaticMaterials.Empty();
@@ -9252,38 +10717,54 @@ FHoudiniEngineUtils::HapiGetVertexListForGroup(
     TArray< int32 > & AllVertexList, TArray< int32 > & AllFaceList,
     TArray< int32 > & AllCollisionFaceIndices )
 {
-    NewVertexList.Init( -1, FullVertexList.Num() );
-    int32 ProcessedWedges = 0;
-
-    AllFaceList.Empty();
-
     TArray< int32 > PartGroupMembership;
     FHoudiniEngineUtils::HapiGetGroupMembership(
         AssetId, ObjectId, GeoId, PartId, HAPI_GROUPTYPE_PRIM, GroupName, PartGroupMembership );
 
-    // Go through all primitives.
+    TBitArray<> GroupFaceMembership( false, PartGroupMembership.Num() );
     for ( int32 FaceIdx = 0; FaceIdx < PartGroupMembership.Num(); ++FaceIdx )
     {
         if ( PartGroupMembership[ FaceIdx ] > 0 )
-        {
-            // Add face.
-            AllFaceList.Add( FaceIdx );
+            GroupFaceMembership[ FaceIdx ] = true;
+    }
 
-            // This face is a member of specified group.
-            NewVertexList[ FaceIdx * 3 + 0 ] = FullVertexList[ FaceIdx * 3 + 0 ];
-            NewVertexList[ FaceIdx * 3 + 1 ] = FullVertexList[ FaceIdx * 3 + 1 ];
-            NewVertexList[ FaceIdx * 3 + 2 ] = FullVertexList[ FaceIdx * 3 + 2 ];
+    return FHoudiniEngineUtils::GetVertexListForGroup(
+        GroupFaceMembership, FullVertexList, NewVertexList, AllVertexList, AllFaceList, AllCollisionFaceIndices );
+}
 
-            // Mark these vertex indices as used.
-            AllVertexList[ FaceIdx * 3 + 0 ] = 1;
-            AllVertexList[ FaceIdx * 3 + 1 ] = 1;
-            AllVertexList[ FaceIdx * 3 + 2 ] = 1;
+int32
+FHoudiniEngineUtils::GetVertexListForGroup(
+    const TBitArray<> & GroupFaceMembership, const TArray< int32 > & FullVertexList,
+    TArray< int32 > & NewVertexList, TArray< int32 > & AllVertexList, TArray< int32 > & AllFaceList,
+    TArray< int32 > & AllCollisionFaceIndices )
+{
+    NewVertexList.Init( -1, FullVertexList.Num() );
+    int32 ProcessedWedges = 0;
 
-            // Mark this face as used.
-            AllCollisionFaceIndices[ FaceIdx ] = 1;
+    AllFaceList.Empty();
 
-            ProcessedWedges += 3;
-        }
+    // Go through all member primitives.
+    for ( TConstSetBitIterator<> It( GroupFaceMembership ); It; ++It )
+    {
+        const int32 FaceIdx = It.GetIndex();
+
+        // Add face.
+        AllFaceList.Add( FaceIdx );
+
+        // This face is a member of specified group.
+        NewVertexList[ FaceIdx * 3 + 0 ] = FullVertexList[ FaceIdx * 3 + 0 ];
+        NewVertexList[ FaceIdx * 3 + 1 ] = FullVertexList[ FaceIdx * 3 + 1 ];
+        NewVertexList[ FaceIdx * 3 + 2 ] = FullVertexList[ FaceIdx * 3 + 2 ];
+
+        // Mark these vertex indices as used.
+        AllVertexList[ FaceIdx * 3 + 0 ] = 1;
+        AllVertexList[ FaceIdx * 3 + 1 ] = 1;
+        AllVertexList[ FaceIdx * 3 + 2 ] = 1;
+
+        // Mark this face as used.
+        AllCollisionFaceIndices[ FaceIdx ] = 1;
+
+        ProcessedWedges += 3;
     }
 
     return ProcessedWedges;
@@ -9569,53 +11050,278 @@ FHoudiniEngineUtils::LocateClipboardActor( const AActor* IgnoreActor, const FStr
 }
 
 void
-FHoudiniEngineUtils::UpdateInstancedStaticMeshComponentInstances(
-    USceneComponent * Component,
+FHoudiniEngineUtils::ApplyInstanceOffsets(
+    const TArray< FTransform > & InstancedTransforms,
+    const FRotator & RotationOffset, const FVector & ScaleOffset,
+    TArray< FTransform > & ProcessedTransforms )
+{
+    ProcessedTransforms.Empty( InstancedTransforms.Num() );
+
+    const FQuat RotationOffsetQuat = RotationOffset.Quaternion();
+    for ( int32 InstanceIdx = 0; InstanceIdx < InstancedTransforms.Num(); ++InstanceIdx )
+    {
+        FTransform Transform = InstancedTransforms[ InstanceIdx ];
+
+        // Compute new rotation and scale.
+        FQuat TransformRotation = Transform.GetRotation() * RotationOffsetQuat;
+        FVector TransformScale3D = Transform.GetScale3D() * ScaleOffset;
+
+        // Make sure inverse matrix exists - seems to be a bug in Unreal when submitting instances.
+        // Happens in blueprint as well.
+        if ( TransformScale3D.X < HAPI_UNREAL_SCALE_SMALL_VALUE )
+            TransformScale3D.X = HAPI_UNREAL_SCALE_SMALL_VALUE;
+
+        if ( TransformScale3D.Y < HAPI_UNREAL_SCALE_SMALL_VALUE )
+            TransformScale3D.Y = HAPI_UNREAL_SCALE_SMALL_VALUE;
+
+        if ( TransformScale3D.Z < HAPI_UNREAL_SCALE_SMALL_VALUE )
+            TransformScale3D.Z = HAPI_UNREAL_SCALE_SMALL_VALUE;
+
+        Transform.SetRotation( TransformRotation );
+        Transform.SetScale3D( TransformScale3D );
+
+        ProcessedTransforms.Add( Transform );
+    }
+}
+
+void
+FHoudiniEngineUtils::UpdateFoliageInstances(
+    USceneComponent * BaseComponent, UStaticMesh * StaticMesh,
+    const UFoliageType_InstancedStaticMesh * DefaultFoliageSettings,
     const TArray< FTransform > & InstancedTransforms,
     const FRotator & RotationOffset, const FVector & ScaleOffset )
 {
-    UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>( Component );
-    UHoudiniInstancedActorComponent* IAC = Cast<UHoudiniInstancedActorComponent>( Component );
-    
-    check( ISMC || IAC );
+#if WITH_EDITOR
+    if ( !BaseComponent || !StaticMesh )
+        return;
 
-    auto ProcessOffsets = [&]() {
-        TArray<FTransform> ProcessedTransforms;
-        ProcessedTransforms.Reserve( InstancedTransforms.Num() );
+    ULevel * Level = BaseComponent->GetComponentLevel();
+    if ( !Level )
+        return;
+
+    AInstancedFoliageActor * InstancedFoliageActor =
+        AInstancedFoliageActor::GetInstancedFoliageActorForLevel( Level, InstancedTransforms.Num() > 0 );
+    if ( !InstancedFoliageActor )
+        return;
 
-        for ( int32 InstanceIdx = 0; InstanceIdx < InstancedTransforms.Num(); ++InstanceIdx )
+    if ( InstancedTransforms.Num() == 0 )
+    {
+        InstancedFoliageActor->DeleteInstancesForComponent( BaseComponent );
+        return;
+    }
+
+    // Reuse the foliage type already registered for this mesh, or register one from default settings.
+    FFoliageMeshInfo * FoliageMeshInfo = nullptr;
+    UFoliageType * FoliageType = InstancedFoliageActor->GetLocalFoliageTypeForMesh( StaticMesh, &FoliageMeshInfo );
+    if ( !FoliageType || !FoliageMeshInfo )
+        FoliageType = InstancedFoliageActor->AddMesh( StaticMesh, &FoliageMeshInfo, DefaultFoliageSettings );
+
+    if ( !FoliageType || !FoliageMeshInfo )
+        return;
+
+    InstancedFoliageActor->Modify();
+
+    // Instances this component left under another foliage type (the mesh has changed) are dropped.
+    for ( auto & FoliageMeshPair : InstancedFoliageActor->FoliageMeshes )
+    {
+        if ( FoliageMeshPair.Key == FoliageType )
+            continue;
+
+        FFoliageMeshInfo & OtherFoliageMeshInfo = *FoliageMeshPair.Value;
+        if ( const TSet< int32 > * OtherInstanceSet = OtherFoliageMeshInfo.ComponentHash.Find( BaseComponent ) )
         {
-            FTransform Transform = InstancedTransforms[ InstanceIdx ];
+            TArray< int32 > InstancesToRemove = OtherInstanceSet->Array();
+            OtherFoliageMeshInfo.RemoveInstances( InstancedFoliageActor, InstancesToRemove, true );
+        }
+    }
+
+    // Existing instances of this component, in the order they were added.
+    TArray< int32 > ExistingInstances;
+    if ( const TSet< int32 > * InstanceSet = FoliageMeshInfo->ComponentHash.Find( BaseComponent ) )
+    {
+        ExistingInstances = InstanceSet->Array();
+        ExistingInstances.Sort();
+    }
 
-            // Compute new rotation and scale.
-            FQuat TransformRotation = Transform.GetRotation() * RotationOffset.Quaternion();
-            FVector TransformScale3D = Transform.GetScale3D() * ScaleOffset;
+    TArray< FTransform > ProcessedTransforms;
+    FHoudiniEngineUtils::ApplyInstanceOffsets( InstancedTransforms, RotationOffset, ScaleOffset, ProcessedTransforms );
 
-            // Make sure inverse matrix exists - seems to be a bug in Unreal when submitting instances.
-            // Happens in blueprint as well.
-            if ( TransformScale3D.X < HAPI_UNREAL_SCALE_SMALL_VALUE )
-                TransformScale3D.X = HAPI_UNREAL_SCALE_SMALL_VALUE;
+    // Instances are based on the component, so foliage follows it and can be found again on the next cook.
+    const FTransform & ComponentTransform = BaseComponent->GetComponentToWorld();
 
-            if ( TransformScale3D.Y < HAPI_UNREAL_SCALE_SMALL_VALUE )
-                TransformScale3D.Y = HAPI_UNREAL_SCALE_SMALL_VALUE;
+    auto InitFoliageInstance = [ & ]( FFoliageInstance & FoliageInstance, int32 InstanceIdx )
+    {
+        const FTransform WorldTransform = ProcessedTransforms[ InstanceIdx ] * ComponentTransform;
+        FoliageInstance.Location = WorldTransform.GetLocation();
+        FoliageInstance.Rotation = WorldTransform.Rotator();
+        FoliageInstance.DrawScale3D = WorldTransform.GetScale3D();
+        FoliageInstance.BaseComponent = BaseComponent;
+    };
+
+    // Instances present before and after the cook are matched by index and only moved if they changed.
+    const int32 KeptCount = FMath::Min( ExistingInstances.Num(), ProcessedTransforms.Num() );
+
+    TArray< int32 > MovedInstances;
+    TArray< FFoliageInstance > MovedFoliageInstances;
+    for ( int32 InstanceIdx = 0; InstanceIdx < KeptCount; ++InstanceIdx )
+    {
+        const FFoliageInstance & ExistingInstance = FoliageMeshInfo->Instances[ ExistingInstances[ InstanceIdx ] ];
+
+        FFoliageInstance FoliageInstance = ExistingInstance;
+        InitFoliageInstance( FoliageInstance, InstanceIdx );
+
+        if ( FoliageInstance.Location.Equals( ExistingInstance.Location ) &&
+            FoliageInstance.Rotation.Equals( ExistingInstance.Rotation ) &&
+            FoliageInstance.DrawScale3D.Equals( ExistingInstance.DrawScale3D ) )
+            continue;
+
+        MovedInstances.Add( ExistingInstances[ InstanceIdx ] );
+        MovedFoliageInstances.Add( FoliageInstance );
+    }
+
+    if ( MovedInstances.Num() > 0 )
+    {
+        FoliageMeshInfo->PreMoveInstances( InstancedFoliageActor, MovedInstances );
+        for ( int32 MovedIdx = 0; MovedIdx < MovedInstances.Num(); ++MovedIdx )
+            FoliageMeshInfo->Instances[ MovedInstances[ MovedIdx ] ] = MovedFoliageInstances[ MovedIdx ];
+        FoliageMeshInfo->PostMoveInstances( InstancedFoliageActor, MovedInstances );
+    }
+
+    // Instances the cook no longer produces.
+    if ( ExistingInstances.Num() > KeptCount )
+    {
+        TArray< int32 > InstancesToRemove( &ExistingInstances[ KeptCount ], ExistingInstances.Num() - KeptCount );
+        FoliageMeshInfo->RemoveInstances( InstancedFoliageActor, InstancesToRemove, true );
+    }
 
-            if ( TransformScale3D.Z < HAPI_UNREAL_SCALE_SMALL_VALUE )
-                TransformScale3D.Z = HAPI_UNREAL_SCALE_SMALL_VALUE;
+    // New instances are submitted in one batch so the foliage tree is only rebuilt once.
+    if ( ProcessedTransforms.Num() > KeptCount )
+    {
+        const int32 AddedCount = ProcessedTransforms.Num() - KeptCount;
+
+        TArray< FFoliageInstance > FoliageInstances;
+        FoliageInstances.SetNum( AddedCount );
 
-            Transform.SetRotation( TransformRotation );
-            Transform.SetScale3D( TransformScale3D );
+        TArray< const FFoliageInstance * > FoliageInstancePointers;
+        FoliageInstancePointers.SetNumUninitialized( AddedCount );
 
-            ProcessedTransforms.Add( Transform );
+        for ( int32 AddedIdx = 0; AddedIdx < AddedCount; ++AddedIdx )
+        {
+            InitFoliageInstance( FoliageInstances[ AddedIdx ], KeptCount + AddedIdx );
+            FoliageInstancePointers[ AddedIdx ] = &FoliageInstances[ AddedIdx ];
         }
+
+        FoliageMeshInfo->AddInstances( InstancedFoliageActor, FoliageType, FoliageInstancePointers );
+    }
+#endif
+}
+
+void
+FHoudiniEngineUtils::ClearFoliageInstances( USceneComponent * BaseComponent )
+{
+#if WITH_EDITOR
+    if ( !BaseComponent )
+        return;
+
+    ULevel * Level = BaseComponent->GetComponentLevel();
+    if ( !Level )
+        return;
+
+    if ( AInstancedFoliageActor * InstancedFoliageActor =
+        AInstancedFoliageActor::GetInstancedFoliageActorForLevel( Level, false ) )
+    {
+        InstancedFoliageActor->DeleteInstancesForComponent( BaseComponent );
+    }
+#endif
+}
+
+void
+FHoudiniEngineUtils::GetFoliageInstanceTransforms(
+    const USceneComponent * BaseComponent, TArray< FTransform > & OutWorldTransforms )
+{
+    OutWorldTransforms.Empty();
+
+#if WITH_EDITOR
+    if ( !BaseComponent )
+        return;
+
+    ULevel * Level = BaseComponent->GetComponentLevel();
+    if ( !Level )
+        return;
+
+    AInstancedFoliageActor * InstancedFoliageActor =
+        AInstancedFoliageActor::GetInstancedFoliageActorForLevel( Level, false );
+    if ( !InstancedFoliageActor )
+        return;
+
+    UActorComponent * BaseActorComponent = const_cast< USceneComponent * >( BaseComponent );
+    for ( const auto & FoliageMeshPair : InstancedFoliageActor->FoliageMeshes )
+    {
+        const FFoliageMeshInfo & FoliageMeshInfo = *FoliageMeshPair.Value;
+        const TSet< int32 > * InstanceSet = FoliageMeshInfo.ComponentHash.Find( BaseActorComponent );
+        if ( !InstanceSet )
+            continue;
+
+        TArray< int32 > Instances = InstanceSet->Array();
+        Instances.Sort();
+
+        for ( int32 InstanceIdx : Instances )
+            OutWorldTransforms.Add( FoliageMeshInfo.Instances[ InstanceIdx ].GetInstanceWorldTransform() );
+    }
+#endif
+}
+
+void
+FHoudiniEngineUtils::UpdateInstancedStaticMeshComponentInstances(
+    USceneComponent * Component,
+    const TArray< FTransform > & InstancedTransforms,
+    const FRotator & RotationOffset, const FVector & ScaleOffset )
+{
+    UInstancedStaticMeshComponent* ISMC = Cast<UInstancedStaticMeshComponent>( Component );
+    UHoudiniInstancedActorComponent* IAC = Cast<UHoudiniInstancedActorComponent>( Component );
+    
+    check( ISMC || IAC );
+
+    auto ProcessOffsets = [&]() {
+        TArray<FTransform> ProcessedTransforms;
+        FHoudiniEngineUtils::ApplyInstanceOffsets( InstancedTransforms, RotationOffset, ScaleOffset, ProcessedTransforms );
         return ProcessedTransforms;
     };
 
     if ( ISMC )
     {
-        ISMC->ClearInstances();
-        for ( const auto& Transform : ProcessOffsets() )
+        // Diff against the current instances instead of recreating them all, only instances whose
+        // transform changed are updated, and instances are only added or removed at the tail.
+        const TArray< FTransform > ProcessedTransforms = ProcessOffsets();
+        const int32 NewInstanceCount = ProcessedTransforms.Num();
+        const int32 OldInstanceCount = ISMC->GetInstanceCount();
+
+        for ( int32 InstanceIdx = OldInstanceCount - 1; InstanceIdx >= NewInstanceCount; --InstanceIdx )
+            ISMC->RemoveInstance( InstanceIdx );
+
+        bool bInstancesUpdated = OldInstanceCount != NewInstanceCount;
+        const int32 KeptInstanceCount = FMath::Min( OldInstanceCount, NewInstanceCount );
+        for ( int32 InstanceIdx = 0; InstanceIdx < KeptInstanceCount; ++InstanceIdx )
+        {
+            const FTransform & Transform = ProcessedTransforms[ InstanceIdx ];
+            if ( ISMC->PerInstanceSMData[ InstanceIdx ].Transform.Equals( Transform.ToMatrixWithScale(), KINDA_SMALL_NUMBER ) )
+                continue;
+
+            // Render state is marked dirty once, after all updates.
+            ISMC->UpdateInstanceTransform( InstanceIdx, Transform, false, false, true );
+            bInstancesUpdated = true;
+        }
+
+        for ( int32 InstanceIdx = KeptInstanceCount; InstanceIdx < NewInstanceCount; ++InstanceIdx )
+            ISMC->AddInstance( ProcessedTransforms[ InstanceIdx ] );
+
+        if ( bInstancesUpdated )
         {
-            ISMC->AddInstance( Transform );
+            ISMC->MarkRenderStateDirty();
+
+            // Cluster tree of hierarchical instancers is rebuilt off the game thread.
+            if ( UHierarchicalInstancedStaticMeshComponent * HISMC = Cast< UHierarchicalInstancedStaticMeshComponent >( ISMC ) )
+                HISMC->BuildTreeIfOutdated( true, false );
         }
     }
     else if ( IAC )
@@ -10138,6 +11844,11 @@ FHoudiniEngineUtils::BakeHoudiniActorToActors_StaticMeshes(
 
             if ( const UInstancedStaticMeshComponent* OtherISMC = Cast< const UInstancedStaticMeshComponent>( OtherSMC ) )
             {
+                // With foliage output the component is only the base of instances living in the level's foliage.
+                TArray< FTransform > FoliageTransforms;
+                if ( OtherISMC->GetInstanceCount() == 0 )
+                    FHoudiniEngineUtils::GetFoliageInstanceTransforms( OtherISMC, FoliageTransforms );
+
     #ifdef BAKE_TO_INSTANCEDSTATICMESHCOMPONENT_ACTORS
                 // This is an instanced static mesh component - we will create a generic AActor with a UInstancedStaticMeshComponent root
                 FActorSpawnParameters SpawnInfo;
@@ -10158,6 +11869,8 @@ FHoudiniEngineUtils::BakeHoudiniActorToActors_StaticMeshes(
                         NewActor->AddInstanceComponent( NewISMC );
                         NewActor->SetRootComponent( NewISMC );
                         NewISMC->SetWorldTransform( OtherISMC->GetComponentTransform() );
+                        for ( const FTransform & FoliageTransform : FoliageTransforms )
+                            NewISMC->AddInstanceWorldSpace( FoliageTransform );
                         NewISMC->RegisterComponent();
 
                         NewActor->SetFolderPath( BaseName );
@@ -10180,6 +11893,14 @@ FHoudiniEngineUtils::BakeHoudiniActorToActors_StaticMeshes(
                         PrepNewStaticMeshActor( NewActor );
                     }
                 }
+
+                for ( const FTransform & FoliageTransform : FoliageTransforms )
+                {
+                    if ( AActor* NewActor = Factory->CreateActor( BakedSM, DesiredLevel, FoliageTransform, RF_Transactional ) )
+                    {
+                        PrepNewStaticMeshActor( NewActor );
+                    }
+                }
     #endif
             }
             else
@@ -10321,20 +12042,26 @@ FHoudiniEngineUtils::GetMeshSocketList(
     }
 
     // First, we want to make sure we have at least one socket group before continuing
-    bool bHasSocketGroup = false;
+    TArray< FString > SocketGroupNames;
     for ( int32 GeoGroupNameIdx = 0; GeoGroupNameIdx < ObjectGeoGroupNames.Num(); ++GeoGroupNameIdx )
     {
         const FString & GroupName = ObjectGeoGroupNames[ GeoGroupNameIdx ];
         if ( GroupName.StartsWith( TEXT( HAPI_UNREAL_GROUP_MESH_SOCKETS ), ESearchCase::IgnoreCase ) )
-        {
-            bHasSocketGroup = true;
-            break;
-        }
+            SocketGroupNames.Add( GroupName );
     }
 
-    if ( !bHasSocketGroup )
+    if ( SocketGroupNames.Num() <= 0 )
         return 0;
 
+    // Fetch point membership of all socket groups at once.
+    HAPI_PartInfo PartInfo;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetPartInfo(
+        FHoudiniEngine::Get().GetSession(), GeoId, PartId, &PartInfo ), 0 );
+
+    TArray< TBitArray<> > SocketGroupMemberships;
+    FHoudiniEngineUtils::HapiGetGroupMembershipBits(
+        GeoId, PartInfo, HAPI_GROUPTYPE_POINT, SocketGroupNames, SocketGroupMemberships );
+
     //
     // Get runtime settings.
     const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
@@ -10416,22 +12143,12 @@ FHoudiniEngineUtils::GetMeshSocketList(
         bHasActors = true;
 
     // Extracting Sockets vertices
-    for ( int32 GeoGroupNameIdx = 0; GeoGroupNameIdx < ObjectGeoGroupNames.Num(); ++GeoGroupNameIdx )
+    for ( int32 SocketGroupIdx = 0; SocketGroupIdx < SocketGroupMemberships.Num(); ++SocketGroupIdx )
     {
-        const FString & GroupName = ObjectGeoGroupNames[ GeoGroupNameIdx ];
-        if ( !GroupName.StartsWith ( TEXT ( HAPI_UNREAL_GROUP_MESH_SOCKETS ) , ESearchCase::IgnoreCase ) )
-            continue;
-
-        TArray< int32 > PointGroupMembership;
-        FHoudiniEngineUtils::HapiGetGroupMembership(
-            AssetId, ObjectId, GeoId, PartId, 
-            HAPI_GROUPTYPE_POINT, GroupName, PointGroupMembership );
-
-        // Go through all primitives.
-        for ( int32 PointIdx = 0; PointIdx < PointGroupMembership.Num(); ++PointIdx )
+        // Go through all member points.
+        for ( TConstSetBitIterator<> It( SocketGroupMemberships[ SocketGroupIdx ] ); It; ++It )
         {
-            if ( PointGroupMembership[PointIdx] != 1 )
-                continue;
+            const int32 PointIdx = It.GetIndex();
 
             FTransform currentSocketTransform;
             FVector currentPosition = FVector::ZeroVector;
@@ -49,6 +49,7 @@ class UBlueprint;
 class UStaticMesh;
 class UHoudiniAsset;
 class ALandscapeProxy;
+class ULandscapeComponent;
 class AHoudiniAssetActor;
 class UMaterialExpression;
 class UHoudiniAssetMaterial;
@@ -110,6 +111,10 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** HAPI : Translate HAPI transform to Unreal one. **/
         static void TranslateHapiTransform( const HAPI_Transform & HapiTransform, FTransform & UnrealTransform );
 
+        /** Translate an array of Houdini transforms into Unreal ones, the settings are only read once. **/
+        static void TranslateHapiTransforms(
+            const HAPI_Transform * HapiTransforms, FTransform * UnrealTransforms, int32 TransformCount );
+
         /** HAPI : Translate HAPI Euler transform to Unreal one. **/
         static void TranslateHapiTransform( const HAPI_TransformEuler & HapiTransformEuler, FTransform & UnrealTransform );
 
@@ -173,6 +178,29 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const FRotator & RotationOffset,
             const FVector & ScaleOffset );
 
+        /** Apply variation rotation and scale offsets to instance transforms. **/
+        static void ApplyInstanceOffsets(
+            const TArray< FTransform > & InstancedTransforms,
+            const FRotator & RotationOffset,
+            const FVector & ScaleOffset,
+            TArray< FTransform > & ProcessedTransforms );
+
+        /** Update foliage instances based on given component to the given instances of a static mesh.  **/
+        /** Instances are matched by index, only changed ones are moved, transforms are in component space. **/
+        static void UpdateFoliageInstances(
+            USceneComponent * BaseComponent, UStaticMesh * StaticMesh,
+            const class UFoliageType_InstancedStaticMesh * DefaultFoliageSettings,
+            const TArray< FTransform > & InstancedTransforms,
+            const FRotator & RotationOffset,
+            const FVector & ScaleOffset );
+
+        /** Remove all foliage instances based on given component. **/
+        static void ClearFoliageInstances( USceneComponent * BaseComponent );
+
+        /** Retrieve world transforms of foliage instances based on given component. **/
+        static void GetFoliageInstanceTransforms(
+            const USceneComponent * BaseComponent, TArray< FTransform > & OutWorldTransforms );
+
         /** Retrieves list of asset names contained within the HDA. **/
         static bool GetAssetNames(
             UHoudiniAsset * HoudiniAsset, HAPI_AssetLibraryId & AssetLibraryId,
@@ -199,12 +227,52 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
         /** HAPI : Retrieve object transforms from given asset node id. **/
         static bool HapiGetObjectTransforms( HAPI_NodeId AssetId, TArray< HAPI_Transform > & ObjectTransforms );
 
-        /** HAPI : Marshalling, extract landscape geometry and upload it. Return true on success. **/
-        static bool HapiCreateInputNodeForData(
+        /** Return the landscape components to export, the selected ones only if requested and any is selected. **/
+        static void GetLandscapeComponentsToExport(
+            ALandscapeProxy * LandscapeProxy, bool bExportOnlySelected,
+            TArray< ULandscapeComponent * > & LandscapeComponents );
+
+        /** Return the maximum section base of the given landscape components, used to normalize global UVs. **/
+        static FIntPoint GetLandscapeComponentsSectionBaseMax( const TArray< ULandscapeComponent * > & LandscapeComponents );
+
+        /** HAPI : Marshalling, extract the given landscape components' geometry and upload it to ConnectedAssetId,  **/
+        /** creating it if needed. Global UVs are normalized by UVNormalizationMax. Return true on success.          **/
+        static bool HapiCreateInputNodeForLandscapeComponents(
+            HAPI_NodeId HostAssetId, ALandscapeProxy * LandscapeProxy,
+            const TArray< ULandscapeComponent * > & LandscapeComponents, HAPI_NodeId & ConnectedAssetId,
+            bool bExportMaterials, bool bExportGeometryAsMesh, bool bExportLighting, bool bExportNormalizedUVs,
+            bool bExportTileUVs, const FIntPoint & UVNormalizationMax );
+
+        /** HAPI : Marshalling, upload each landscape component to its own input node, merged in ConnectedAssetId. **/
+        /** Only components whose content hash differs from the previous upload are sent again. The given arrays  **/
+        /** are only updated on success, on failure the input nodes created by this call are destroyed.            **/
+        static bool HapiUpdateInputNodeForLandscapeComponents(
+            HAPI_NodeId HostAssetId, ALandscapeProxy * LandscapeProxy, HAPI_NodeId & ConnectedAssetId,
+            TArray< TWeakObjectPtr< ULandscapeComponent > > & UploadedComponents,
+            TArray< HAPI_NodeId > & UploadedComponentNodeIds, TArray< uint32 > & UploadedComponentHashes,
+            bool bExportOnlySelected, bool bExportMaterials, bool bExportGeometryAsMesh,
+            bool bExportLighting, bool bExportNormalizedUVs, bool bExportTileUVs );
+
+        /** Convert landscape values of size ( XSize, YSize ) to the values of a heightfield volume of size      **/
+        /** ( YSize, XSize ). Heightfields are transposed when imported, so every exported volume is transposed. **/
+        static void ConvertLandscapeDataToHeightfieldData(
+            int32 XSize, int32 YSize, TFunctionRef< float( int32 LandscapeIdx ) > GetValue,
+            TArray< float > & HeightfieldValues );
+
+        /** HAPI : Marshalling, upload the landscape's height and weight layers as heightfield volumes, merged   **/
+        /** in ConnectedAssetId. The volume input nodes are added to OutCreatedNodeIds. Return true on success. **/
+        /** On failure, the merge node and the volume nodes created by this call are destroyed. When only the   **/
+        /** selected components are exported, unselected components inside their bounds are masked out.        **/
+        static bool HapiCreateHeightfieldInputNodeForData(
             HAPI_NodeId HostAssetId,
-            ALandscapeProxy * LandscapeProxy, HAPI_NodeId & ConnectedAssetId, bool bExportOnlySelected, bool bExportCurves,
-            bool bExportMaterials, bool bExportFullGeometry, bool bExportLighting, bool bExportNormalizedUVs,
-            bool bExportTileUVs );
+            ALandscapeProxy * LandscapeProxy, HAPI_NodeId & ConnectedAssetId,
+            TArray< HAPI_NodeId > & OutCreatedNodeIds, bool bExportOnlySelected );
+
+        /** HAPI : Create an input node containing a single 2D float volume. **/
+        static bool HapiCreateInputNodeForHeightfieldVolume(
+            const char * VolumeName, const TArray< float > & Values,
+            int32 XLength, int32 YLength, const HAPI_Transform & VolumeTransform,
+            HAPI_NodeId & InputNodeId );
 
         /** HAPI : Marshaling, extract geometry and create input asset for it - return true on success **/
         static bool HapiCreateInputNodeForData(
@@ -213,11 +281,31 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             HAPI_NodeId & ConnectedAssetId,
             class UStaticMeshComponent* StaticMeshComponent = nullptr );
 
-        /** HAPI : Marshaling, extract geometry and create input asset for it - return true on success **/
+        /** Return a key identifying the uploaded geometry of a static mesh input: the raw mesh, materials and     **/
+        /** marshalling settings. Returns 0 if the input can't be cached and has to be uploaded every time.         **/
+        static uint32 GetStaticMeshInputKey( UStaticMesh * StaticMesh, class UStaticMeshComponent * StaticMeshComponent );
+
+        /** HAPI : Create an object merge node referencing the session's shared input node for the static mesh,   **/
+        /** uploading the mesh if needed. Return false if the mesh can't be shared or on failure.                  **/
+        static bool HapiCreateSharedInputNodeForData(
+            HAPI_NodeId HostAssetId, UStaticMesh * StaticMesh,
+            class UStaticMeshComponent * StaticMeshComponent, HAPI_NodeId & ObjectMergeNodeId );
+
+        /** Mark the shared input node of the static mesh as outdated, so the next input referencing it uploads it again. **/
+        static void InvalidateSharedInputNodeForData( UStaticMesh * StaticMesh );
+
+        /** HAPI : Release the shared input node referenced by the given object merge node, if any, and destroy it **/
+        /** when no input references it anymore. Called by DestroyHoudiniAsset.                                    **/
+        static void HapiReleaseSharedInputNode( HAPI_NodeId ObjectMergeNodeId );
+
+        /** HAPI : Marshaling, extract geometry and create input asset for it - return true on success.            **/
+        /** If ConnectedAssetId is valid, the input nodes in OutCreatedNodeIds are reused and only the meshes whose **/
+        /** key differs from InOutMeshKeys are uploaded again.                                                      **/
         static bool HapiCreateInputNodeForData(
             HAPI_NodeId HostAssetId,
             TArray<UObject *>& InputObjects,
-            HAPI_NodeId & ConnectedAssetId, TArray< HAPI_NodeId >& OutCreatedNodeIds );
+            HAPI_NodeId & ConnectedAssetId, TArray< HAPI_NodeId >& OutCreatedNodeIds,
+            TArray< uint32 >& InOutMeshKeys );
 
         /** HAPI : Marshaling, extract geometry and create input asset for it - return true on success **/
         static bool HapiCreateInputNodeForData(
@@ -226,6 +314,39 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             HAPI_NodeId & ConnectedAssetId,
             const float& SplineResolution = -1.0f);
 
+        /** HAPI : Marshaling, update the world outliner input's merge node, creating it if needed. Only the       **/
+        /** entries without an input node, or whose mesh changed, are uploaded. InOutConnectedNodeIds holds the    **/
+        /** node connected to each merge input, the nodes of removed entries are destroyed - true on success.      **/
+        static bool HapiUpdateInputNodeForData(
+            HAPI_NodeId HostAssetId,
+            TArray< FHoudiniAssetInputOutlinerMesh > & OutlinerMeshArray,
+            HAPI_NodeId & ConnectedAssetId,
+            TArray< HAPI_NodeId > & InOutConnectedNodeIds,
+            const float & SplineResolution = -1.0f );
+
+        /** HAPI : Marshaling, upload each unique mesh of the world outliner input once, and its static mesh       **/
+        /** actors as points with orient, scale, pivot and mesh index attributes, copied as packed primitives.    **/
+        /** Splines and meshes with attribute data get their own input node, stored in their entry's AssetId.    **/
+        /** The created nodes are added to OutCreatedNodeIds, OutPointsNodeId is the instance points input node.  **/
+        /** Return true on success.                                                                               **/
+        static bool HapiCreateInstancedInputNodeForData(
+            HAPI_NodeId HostAssetId,
+            TArray< FHoudiniAssetInputOutlinerMesh > & OutlinerMeshArray,
+            HAPI_NodeId & ConnectedAssetId,
+            TArray< HAPI_NodeId > & OutCreatedNodeIds,
+            HAPI_NodeId & OutPointsNodeId,
+            const float & SplineResolution = -1.0f );
+
+        /** HAPI : Marshaling, set the instance points of the world outliner input's packed instances. Called     **/
+        /** again when only the actors' transforms changed, the meshes are kept - return true on success.         **/
+        static bool HapiSetInstancedInputPoints(
+            HAPI_NodeId PointsNodeId,
+            const TArray< FHoudiniAssetInputOutlinerMesh > & OutlinerMeshArray,
+            TArray< UStaticMesh * > & OutInstancedMeshes );
+
+        /** Return true if the world outliner entry is uploaded as a packed instance of its mesh. **/
+        static bool IsInstancedInputMesh( const FHoudiniAssetInputOutlinerMesh & OutlinerMesh );
+
         /** HAPI : Marshaling, extract points from the Unreal Spline and create an input curve for it - return true on success **/
         static bool HapiCreateInputNodeForData(
             HAPI_NodeId HostAssetId,
@@ -242,6 +363,15 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             TArray<FVector>* Scales3d = nullptr,
             TArray<float>* UniformScales = nullptr);
 
+        /** HAPI : Marshaling, send the CVs of a curve and their rotations and scales as float attributes - return true on success **/
+        /** Curves are not sent as geometry buffers: the encoder only writes polygons, and a curve takes a few calls whatever its size. **/
+        static bool HapiUploadCurveInputNodeData(
+            HAPI_NodeId CurveNodeId, int32 CurveType, bool bClosed,
+            const TArray< FVector > & Positions,
+            const TArray< FQuat > * Rotations = nullptr,
+            const TArray< FVector > * Scales3d = nullptr,
+            const TArray< float > * UniformScales = nullptr );
+
         /** HAPI : Marshaling, disconnect input asset from a given slot. **/
         static bool HapiDisconnectAsset( HAPI_NodeId HostAssetId, int32 InputIndex );
 
@@ -259,6 +389,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             HAPI_PartId PartId, HAPI_GroupType GroupType, const FString & GroupName,
             TArray< int32 > & GroupMembership );
 
+        /** HAPI : Retrieve membership of several groups of a part in one pass, as one bitset per group.            **/
+        /** Uses the supplied part info, so no additional part info query is issued per group.                        **/
+        static bool HapiGetGroupMembershipBits(
+            HAPI_NodeId GeoId, const HAPI_PartInfo & PartInfo, HAPI_GroupType GroupType,
+            const TArray< FString > & GroupNames, TArray< TBitArray<> > & GroupMemberships );
+
         /** HAPI : Get group count by type. **/
         static int32 HapiGetGroupCountByType( HAPI_GroupType GroupType, HAPI_GeoInfo & GeoInfo );
 
@@ -413,6 +549,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             const FHoudiniGeoPartObject & HoudiniGeoPartObject,
             TArray< FTransform > & Transforms );
 
+        /** HAPI : Fetch instance transforms in chunks and translate each chunk directly into given array, while the  **/
+        /** next chunk is fetched. Transforms of the instancer part are fetched when InstancerPartId is valid, the     **/
+        /** geo's point instances otherwise.                                                                           **/
+        static bool HapiFetchInstanceTransforms(
+            HAPI_NodeId GeoId, HAPI_PartId InstancerPartId, int32 InstanceCount, TArray< FTransform > & Transforms );
+
         /** HAPI : Given vertex list, retrieve new vertex list for a specified group.                                   **/
         /** Return number of processed valid index vertices for this split.                                             **/
         static int32 HapiGetVertexListForGroup(
@@ -421,6 +563,13 @@ struct HOUDINIENGINERUNTIME_API FHoudiniEngineUtils
             TArray< int32 > & NewVertexList, TArray< int32 > & AllVertexList, TArray< int32 > & AllFaceList,
             TArray< int32 > & AllCollisionFaceIndices );
 
+        /** Given vertex list and face membership bits of a group, retrieve new vertex list for that group.            **/
+        /** Return number of processed valid index vertices for this split.                                             **/
+        static int32 GetVertexListForGroup(
+            const TBitArray<> & GroupFaceMembership, const TArray< int32 > & FullVertexList,
+            TArray< int32 > & NewVertexList, TArray< int32 > & AllVertexList, TArray< int32 > & AllFaceList,
+            TArray< int32 > & AllCollisionFaceIndices );
+
         /** HAPI : Retrieves the mesh sockets list for the current part							**/
         static int32 GetMeshSocketList(
             HAPI_NodeId AssetId, HAPI_NodeId ObjectId,
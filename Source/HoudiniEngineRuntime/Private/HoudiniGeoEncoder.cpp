@@ -0,0 +1,450 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Produced by:
+*      Mykola Konyk
+*      Side Effects Software Inc
+*      123 Front Street West, Suite 1401
+*      Toronto, Ontario
+*      Canada   M5J 2M2
+*      416-504-9876
+*
+*/
+
+
+#include "HoudiniApi.h"
+#include "HoudiniGeoEncoder.h"
+#include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniEngine.h"
+#include "HoudiniRuntimeSettings.h"
+
+namespace
+{
+    void
+    AppendString( TArray< ANSICHAR > & Buffer, const ANSICHAR * String )
+    {
+        Buffer.Append( String, FCStringAnsi::Strlen( String ) );
+    }
+
+    void
+    AppendQuotedString( TArray< ANSICHAR > & Buffer, const ANSICHAR * String )
+    {
+        Buffer.Add( '"' );
+        for ( const ANSICHAR * Char = String; Char && *Char; ++Char )
+        {
+            // JSON strings can't contain control characters.
+            const uint8 Code = (uint8) *Char;
+            if ( Code < 0x20 )
+            {
+                ANSICHAR Escaped[ 8 ];
+                FCStringAnsi::Sprintf( Escaped, "\\u%04x", Code );
+                AppendString( Buffer, Escaped );
+                continue;
+            }
+
+            if ( *Char == '"' || *Char == '\\' )
+                Buffer.Add( '\\' );
+
+            Buffer.Add( *Char );
+        }
+        Buffer.Add( '"' );
+    }
+
+    void
+    AppendInt( TArray< ANSICHAR > & Buffer, int32 Value )
+    {
+        ANSICHAR Digits[ 16 ];
+        FCStringAnsi::Sprintf( Digits, "%d", Value );
+        AppendString( Buffer, Digits );
+    }
+
+    void
+    AppendFloat( TArray< ANSICHAR > & Buffer, float Value )
+    {
+        // JSON has no representation for NaNs and infinities.
+        if ( !FMath::IsFinite( Value ) )
+            Value = 0.0f;
+
+        // Most values round-trip with fewer digits, which keeps the ASCII buffer smaller.
+        ANSICHAR Digits[ 32 ];
+        FCStringAnsi::Sprintf( Digits, "%.7g", Value );
+        if ( FCStringAnsi::Atof( Digits ) != Value )
+            FCStringAnsi::Sprintf( Digits, "%.9g", Value );
+
+        AppendString( Buffer, Digits );
+    }
+
+    /** Append the values of an attribute, as arrays for single values and tuples otherwise. **/
+    template< typename TValue, typename TAppendValue >
+    void
+    AppendValues( TArray< ANSICHAR > & Buffer, const TValue * Values, int32 Count, int32 TupleSize, TAppendValue AppendValue )
+    {
+        AppendString( Buffer, TupleSize == 1 ? "\"arrays\",[[" : "\"tuples\",[" );
+        for ( int32 Idx = 0; Idx < Count; ++Idx )
+        {
+            if ( Idx > 0 )
+                Buffer.Add( ',' );
+
+            if ( TupleSize == 1 )
+            {
+                AppendValue( Buffer, Values[ Idx ] );
+                continue;
+            }
+
+            Buffer.Add( '[' );
+            for ( int32 TupleIdx = 0; TupleIdx < TupleSize; ++TupleIdx )
+            {
+                if ( TupleIdx > 0 )
+                    Buffer.Add( ',' );
+
+                AppendValue( Buffer, Values[ Idx * TupleSize + TupleIdx ] );
+            }
+            Buffer.Add( ']' );
+        }
+        AppendString( Buffer, TupleSize == 1 ? "]]" : "]" );
+    }
+}
+
+FHoudiniGeoEncoder::FHoudiniGeoEncoder( HAPI_NodeId InGeoNodeId, bool bInEncode )
+    : GeoNodeId( InGeoNodeId )
+    , bEncode( bInEncode )
+{
+    FMemory::Memzero< HAPI_PartInfo >( PartInfo );
+}
+
+bool
+FHoudiniGeoEncoder::IsEncodingEnabled()
+{
+    // In process sessions have no per call transport cost, the attribute data is cheaper to send as is.
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings )
+        return HoudiniRuntimeSettings->bMarshallingUseGeometryBuffer && HoudiniRuntimeSettings->SessionType != HRSST_InProcess;
+
+    return false;
+}
+
+HAPI_Result
+FHoudiniGeoEncoder::SetPartInfo( const HAPI_PartInfo * InPartInfo )
+{
+    if ( !bEncode )
+        return FHoudiniApi::SetPartInfo( FHoudiniEngine::Get().GetSession(), GeoNodeId, 0, InPartInfo );
+
+    if ( !InPartInfo )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    PartInfo = *InPartInfo;
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoEncoder::AddAttribute( const char * Name, const HAPI_AttributeInfo * AttributeInfo )
+{
+    if ( !bEncode )
+        return FHoudiniApi::AddAttribute( FHoudiniEngine::Get().GetSession(), GeoNodeId, 0, Name, AttributeInfo );
+
+    // Attributes are encoded when their data is set.
+    if ( !Name || !AttributeInfo || AttributeInfo->owner < 0 || AttributeInfo->owner >= HAPI_ATTROWNER_MAX )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoEncoder::SetAttributeIntData(
+    const char * Name, const HAPI_AttributeInfo * AttributeInfo,
+    const int * Data, int Start, int Length )
+{
+    if ( !bEncode )
+    {
+        return FHoudiniApi::SetAttributeIntData(
+            FHoudiniEngine::Get().GetSession(), GeoNodeId, 0, Name, AttributeInfo, Data, Start, Length );
+    }
+
+    if ( !Data || !IsWholeAttribute( AttributeInfo, Start, Length ) )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    TArray< ANSICHAR > & Buffer = BeginAttribute( Name, AttributeInfo, "numeric", "int32" );
+    AppendValues( Buffer, Data, Length, AttributeInfo->tupleSize, &AppendInt );
+    AppendString( Buffer, "]]]" );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoEncoder::SetAttributeFloatData(
+    const char * Name, const HAPI_AttributeInfo * AttributeInfo,
+    const float * Data, int Start, int Length )
+{
+    if ( !bEncode )
+    {
+        return FHoudiniApi::SetAttributeFloatData(
+            FHoudiniEngine::Get().GetSession(), GeoNodeId, 0, Name, AttributeInfo, Data, Start, Length );
+    }
+
+    if ( !Data || !IsWholeAttribute( AttributeInfo, Start, Length ) )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    TArray< ANSICHAR > & Buffer = BeginAttribute( Name, AttributeInfo, "numeric", "fpreal32" );
+    AppendValues( Buffer, Data, Length, AttributeInfo->tupleSize, &AppendFloat );
+    AppendString( Buffer, "]]]" );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoEncoder::SetAttributeStringData(
+    const char * Name, const HAPI_AttributeInfo * AttributeInfo,
+    const char ** Data, int Start, int Length )
+{
+    if ( !bEncode )
+    {
+        return FHoudiniApi::SetAttributeStringData(
+            FHoudiniEngine::Get().GetSession(), GeoNodeId, 0, Name, AttributeInfo, Data, Start, Length );
+    }
+
+    if ( !Data || !IsWholeAttribute( AttributeInfo, Start, Length ) || AttributeInfo->tupleSize != 1 )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    // Strings are stored once, and referenced by index. The same pointers are usually passed for equal
+    // strings, so these are looked up first, and other strings are only compared when their hash matches.
+    TArray< const char * > UniqueStrings;
+    TMap< const char *, int32 > PointerStringIndices;
+    TMultiMap< uint32, int32 > HashStringIndices;
+    TArray< int32 > StringIndices;
+    StringIndices.SetNumUninitialized( Length );
+
+    for ( int32 Idx = 0; Idx < Length; ++Idx )
+    {
+        const char * String = Data[ Idx ] ? Data[ Idx ] : "";
+
+        int32 * UniqueIdx = PointerStringIndices.Find( String );
+        if ( !UniqueIdx )
+        {
+            const uint32 Hash = FCrc::MemCrc32( String, FCStringAnsi::Strlen( String ) );
+
+            int32 StringIdx = INDEX_NONE;
+            for ( auto Iter = HashStringIndices.CreateConstKeyIterator( Hash ); Iter; ++Iter )
+            {
+                if ( FCStringAnsi::Strcmp( UniqueStrings[ Iter.Value() ], String ) == 0 )
+                {
+                    StringIdx = Iter.Value();
+                    break;
+                }
+            }
+
+            if ( StringIdx == INDEX_NONE )
+            {
+                StringIdx = UniqueStrings.Add( String );
+                HashStringIndices.Add( Hash, StringIdx );
+            }
+
+            UniqueIdx = &PointerStringIndices.Add( String, StringIdx );
+        }
+
+        StringIndices[ Idx ] = *UniqueIdx;
+    }
+
+    TArray< ANSICHAR > & Buffer = EncodedAttributes[ AttributeInfo->owner ];
+    if ( Buffer.Num() > 0 )
+        Buffer.Add( ',' );
+
+    AppendString( Buffer, "[[\"scope\",\"public\",\"type\",\"string\",\"name\"," );
+    AppendQuotedString( Buffer, Name );
+    AppendString( Buffer, "],[\"size\",1,\"storage\",\"int32\",\"strings\",[" );
+    for ( int32 Idx = 0; Idx < UniqueStrings.Num(); ++Idx )
+    {
+        if ( Idx > 0 )
+            Buffer.Add( ',' );
+
+        AppendQuotedString( Buffer, UniqueStrings[ Idx ] );
+    }
+    AppendString( Buffer, "],\"indices\",[\"size\",1,\"storage\",\"int32\"," );
+    AppendValues( Buffer, StringIndices.GetData(), StringIndices.Num(), 1, &AppendInt );
+    AppendString( Buffer, "]]]" );
+
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoEncoder::SetVertexList( const int * InVertexList, int Start, int Length )
+{
+    if ( !bEncode )
+    {
+        return FHoudiniApi::SetVertexList(
+            FHoudiniEngine::Get().GetSession(), GeoNodeId, 0, InVertexList, Start, Length );
+    }
+
+    if ( !InVertexList || Start != 0 || Length != PartInfo.vertexCount )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    VertexList = TArray< int32 >( InVertexList, Length );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoEncoder::SetFaceCounts( const int * InFaceCounts, int Start, int Length )
+{
+    if ( !bEncode )
+    {
+        return FHoudiniApi::SetFaceCounts(
+            FHoudiniEngine::Get().GetSession(), GeoNodeId, 0, InFaceCounts, Start, Length );
+    }
+
+    if ( !InFaceCounts || Start != 0 || Length != PartInfo.faceCount )
+        return HAPI_RESULT_INVALID_ARGUMENT;
+
+    FaceCounts = TArray< int32 >( InFaceCounts, Length );
+    return HAPI_RESULT_SUCCESS;
+}
+
+HAPI_Result
+FHoudiniGeoEncoder::CommitGeo()
+{
+    if ( !bEncode )
+        return FHoudiniApi::CommitGeo( FHoudiniEngine::Get().GetSession(), GeoNodeId );
+
+    TArray< ANSICHAR > Buffer;
+    Encode( Buffer );
+
+    return FHoudiniApi::LoadGeoFromMemory(
+        FHoudiniEngine::Get().GetSession(), GeoNodeId,
+        HAPI_UNREAL_GEO_BUFFER_FORMAT, Buffer.GetData(), Buffer.Num() );
+}
+
+void
+FHoudiniGeoEncoder::Encode( TArray< ANSICHAR > & OutBuffer ) const
+{
+    static const ANSICHAR * OwnerSections[ HAPI_ATTROWNER_MAX ] =
+    {
+        "vertexattributes", "pointattributes", "primitiveattributes", "globalattributes"
+    };
+
+    int32 EncodedSize = 0;
+    for ( const auto & EncodedAttribute : EncodedAttributes )
+        EncodedSize += EncodedAttribute.Num();
+
+    OutBuffer.Empty( EncodedSize + VertexList.Num() * 8 + 256 );
+
+    AppendString( OutBuffer, "[\"fileversion\",\"" );
+    AppendInt( OutBuffer, HAPI_VERSION_HOUDINI_MAJOR );
+    OutBuffer.Add( '.' );
+    AppendInt( OutBuffer, HAPI_VERSION_HOUDINI_MINOR );
+    OutBuffer.Add( '.' );
+    AppendInt( OutBuffer, HAPI_VERSION_HOUDINI_BUILD );
+    AppendString( OutBuffer, "\",\"pointcount\"," );
+    AppendInt( OutBuffer, PartInfo.pointCount );
+    AppendString( OutBuffer, ",\"vertexcount\"," );
+    AppendInt( OutBuffer, VertexList.Num() );
+    AppendString( OutBuffer, ",\"primitivecount\"," );
+    AppendInt( OutBuffer, FaceCounts.Num() );
+
+    // Point of each vertex.
+    AppendString( OutBuffer, ",\"topology\",[\"pointref\",[\"indices\",[" );
+    for ( int32 VertexIdx = 0; VertexIdx < VertexList.Num(); ++VertexIdx )
+    {
+        if ( VertexIdx > 0 )
+            OutBuffer.Add( ',' );
+
+        AppendInt( OutBuffer, VertexList[ VertexIdx ] );
+    }
+    AppendString( OutBuffer, "]]]" );
+
+    AppendString( OutBuffer, ",\"attributes\",[" );
+    bool bFirstSection = true;
+    for ( int32 OwnerIdx = 0; OwnerIdx < HAPI_ATTROWNER_MAX; ++OwnerIdx )
+    {
+        if ( EncodedAttributes[ OwnerIdx ].Num() <= 0 )
+            continue;
+
+        if ( !bFirstSection )
+            OutBuffer.Add( ',' );
+
+        bFirstSection = false;
+        AppendQuotedString( OutBuffer, OwnerSections[ OwnerIdx ] );
+        AppendString( OutBuffer, ",[" );
+        OutBuffer.Append( EncodedAttributes[ OwnerIdx ] );
+        OutBuffer.Add( ']' );
+    }
+    OutBuffer.Add( ']' );
+
+    // All the faces are closed polygons, stored as a single run with run-length encoded vertex counts.
+    AppendString( OutBuffer, ",\"primitives\",[" );
+    if ( FaceCounts.Num() > 0 )
+    {
+        AppendString( OutBuffer, "[[\"type\",\"Polygon_run\"],[\"startvertex\",0,\"nprimitives\"," );
+        AppendInt( OutBuffer, FaceCounts.Num() );
+        AppendString( OutBuffer, ",\"nvertices_rle\",[" );
+
+        for ( int32 FaceIdx = 0; FaceIdx < FaceCounts.Num(); )
+        {
+            int32 RunLength = 1;
+            while ( FaceIdx + RunLength < FaceCounts.Num() && FaceCounts[ FaceIdx + RunLength ] == FaceCounts[ FaceIdx ] )
+                RunLength++;
+
+            if ( FaceIdx > 0 )
+                OutBuffer.Add( ',' );
+
+            AppendInt( OutBuffer, FaceCounts[ FaceIdx ] );
+            OutBuffer.Add( ',' );
+            AppendInt( OutBuffer, RunLength );
+
+            FaceIdx += RunLength;
+        }
+
+        AppendString( OutBuffer, "]]]" );
+    }
+    AppendString( OutBuffer, "]]" );
+}
+
+bool
+FHoudiniGeoEncoder::IsWholeAttribute( const HAPI_AttributeInfo * AttributeInfo, int Start, int Length ) const
+{
+    if ( !AttributeInfo || AttributeInfo->owner < 0 || AttributeInfo->owner >= HAPI_ATTROWNER_MAX )
+        return false;
+
+    return Start == 0 && Length == AttributeInfo->count && AttributeInfo->tupleSize > 0;
+}
+
+TArray< ANSICHAR > &
+FHoudiniGeoEncoder::BeginAttribute(
+    const char * Name, const HAPI_AttributeInfo * AttributeInfo,
+    const char * Type, const char * Storage )
+{
+    TArray< ANSICHAR > & Buffer = EncodedAttributes[ AttributeInfo->owner ];
+    if ( Buffer.Num() > 0 )
+        Buffer.Add( ',' );
+
+    AppendString( Buffer, "[[\"scope\",\"public\",\"type\",\"" );
+    AppendString( Buffer, Type );
+    AppendString( Buffer, "\",\"name\"," );
+    AppendQuotedString( Buffer, Name );
+    AppendString( Buffer, "],[\"size\"," );
+    AppendInt( Buffer, AttributeInfo->tupleSize );
+    AppendString( Buffer, ",\"storage\",\"" );
+    AppendString( Buffer, Storage );
+    AppendString( Buffer, "\",\"defaults\",[\"size\",1,\"storage\",\"fpreal64\",\"values\",[0]],\"values\",[\"size\"," );
+    AppendInt( Buffer, AttributeInfo->tupleSize );
+    AppendString( Buffer, ",\"storage\",\"" );
+    AppendString( Buffer, Storage );
+    AppendString( Buffer, "\"," );
+
+    return Buffer;
+}
@@ -0,0 +1,109 @@
+/*
+* Copyright (c) <2017> Side Effects Software Inc.
+*
+* Permission is hereby granted, free of charge, to any person obtaining a copy
+* of this software and associated documentation files (the "Software"), to deal
+* in the Software without restriction, including without limitation the rights
+* to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+* copies of the Software, and to permit persons to whom the Software is
+* furnished to do so, subject to the following conditions:
+*
+* The above copyright notice and this permission notice shall be included in all
+* copies or substantial portions of the Software.
+*
+* THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+* IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+* FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+* AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+* LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+* OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+* SOFTWARE.
+*
+* Produced by:
+*      Mykola Konyk
+*      Side Effects Software Inc
+*      123 Front Street West, Suite 1401
+*      Toronto, Ontario
+*      Canada   M5J 2M2
+*      416-504-9876
+*
+*/
+
+
+#pragma once
+
+#include "HAPI_Common.h"
+#include "CoreMinimal.h"
+
+
+/** Stages the part of an input geometry node. When encoding, the part is serialized to a Houdini JSON geometry **/
+/** buffer and loaded with a single call when committed, otherwise each call is forwarded to HAPI. **/
+class HOUDINIENGINERUNTIME_API FHoudiniGeoEncoder
+{
+    public:
+
+        FHoudiniGeoEncoder( HAPI_NodeId InGeoNodeId, bool bInEncode );
+
+    public:
+
+        /** Return true if the runtime settings enable the encoding of input geometry, for out of process sessions. **/
+        static bool IsEncodingEnabled();
+
+    public:
+
+        HAPI_Result SetPartInfo( const HAPI_PartInfo * InPartInfo );
+
+        HAPI_Result AddAttribute( const char * Name, const HAPI_AttributeInfo * AttributeInfo );
+
+        HAPI_Result SetAttributeIntData(
+            const char * Name, const HAPI_AttributeInfo * AttributeInfo,
+            const int * Data, int Start, int Length );
+
+        HAPI_Result SetAttributeFloatData(
+            const char * Name, const HAPI_AttributeInfo * AttributeInfo,
+            const float * Data, int Start, int Length );
+
+        HAPI_Result SetAttributeStringData(
+            const char * Name, const HAPI_AttributeInfo * AttributeInfo,
+            const char ** Data, int Start, int Length );
+
+        HAPI_Result SetVertexList( const int * InVertexList, int Start, int Length );
+
+        HAPI_Result SetFaceCounts( const int * InFaceCounts, int Start, int Length );
+
+        /** Send the encoded geometry buffer, or commit the geometry set through HAPI. **/
+        HAPI_Result CommitGeo();
+
+    public:
+
+        /** Serialize the staged part to a Houdini JSON geometry buffer. **/
+        void Encode( TArray< ANSICHAR > & OutBuffer ) const;
+
+    protected:
+
+        /** Return true if the attribute data covers the whole attribute. **/
+        bool IsWholeAttribute( const HAPI_AttributeInfo * AttributeInfo, int Start, int Length ) const;
+
+        /** Start the encoding of an attribute, return the buffer its values have to be appended to. **/
+        TArray< ANSICHAR > & BeginAttribute(
+            const char * Name, const HAPI_AttributeInfo * AttributeInfo,
+            const char * Type, const char * Storage );
+
+    protected:
+
+        /** Id of the geometry node receiving the part. **/
+        HAPI_NodeId GeoNodeId;
+
+        /** Part being staged. **/
+        HAPI_PartInfo PartInfo;
+
+        /** Vertex list and face counts of the part. **/
+        TArray< int32 > VertexList;
+        TArray< int32 > FaceCounts;
+
+        /** Encoded attributes of the part, for each owner. **/
+        TArray< ANSICHAR > EncodedAttributes[ HAPI_ATTROWNER_MAX ];
+
+        /** Is set to true when the part is encoded instead of sent through HAPI. **/
+        bool bEncode;
+};
@@ -586,29 +586,7 @@ FHoudiniGeoPartObject::HapiGetInstanceTransforms( HAPI_NodeId OtherAssetId, TArr
     int32 PointCount = HapiPartGetPointCount( OtherAssetId );
 
     if ( PointCount > 0 )
-    {
-        TArray< HAPI_Transform > InstanceTransforms;
-        InstanceTransforms.SetNumZeroed( PointCount );
-
-        if ( FHoudiniApi::GetInstanceTransforms(
-            FHoudiniEngine::Get().GetSession(), GeoId, HAPI_SRT, &InstanceTransforms[ 0 ],
-            0, PointCount) == HAPI_RESULT_SUCCESS )
-        {
-            for ( int32 PointIdx = 0; PointIdx < PointCount; ++PointIdx )
-            {
-                FTransform TempTransformMatrix;
-
-                const HAPI_Transform & HapiInstanceTransform = InstanceTransforms[ PointIdx ];
-                FHoudiniEngineUtils::TranslateHapiTransform( HapiInstanceTransform, TempTransformMatrix );
-
-                AllTransforms.Add( TempTransformMatrix );
-            }
-        }
-        else
-        {
-            return false;
-        }
-    }
+        return FHoudiniEngineUtils::HapiFetchInstanceTransforms( GeoId, -1, PointCount, AllTransforms );
 
     return true;
 }
@@ -1759,6 +1737,40 @@ FHoudiniGeoPartObject::HapiGetAttributeDataAsString(
     return false;
 }
 
+bool
+FHoudiniGeoPartObject::HapiGetAttributeDataAsStringHandles(
+    HAPI_NodeId OtherAssetId, const char * AttributeName,
+    HAPI_AttributeOwner AttributeOwner, HAPI_AttributeInfo & ResultAttributeInfo,
+    TArray< HAPI_StringHandle > & AttributeData ) const
+{
+    AttributeData.SetNumUninitialized( 0 );
+
+    if ( !HapiGetAttributeInfo( OtherAssetId, AttributeName, AttributeOwner, ResultAttributeInfo ) )
+    {
+        ResultAttributeInfo.exists = false;
+        return false;
+    }
+
+    if ( !ResultAttributeInfo.exists )
+        return false;
+
+    AttributeData.Init( -1, ResultAttributeInfo.count * ResultAttributeInfo.tupleSize );
+    if ( AttributeData.Num() == 0 )
+        return true;
+
+    if ( FHoudiniApi::GetAttributeStringData(
+        FHoudiniEngine::Get().GetSession(),
+        GeoId, PartId, AttributeName, &ResultAttributeInfo,
+        &AttributeData[ 0 ], 0, ResultAttributeInfo.count ) == HAPI_RESULT_SUCCESS )
+    {
+        return true;
+    }
+
+    AttributeData.SetNumUninitialized( 0 );
+    ResultAttributeInfo.exists = false;
+    return false;
+}
+
 bool
 FHoudiniGeoPartObject::HapiGetAttributeDataAsString(
     const char * AttributeName, HAPI_AttributeOwner AttributeOwner,
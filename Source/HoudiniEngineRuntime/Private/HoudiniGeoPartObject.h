@@ -337,6 +337,12 @@ struct HOUDINIENGINERUNTIME_API FHoudiniGeoPartObject
             HAPI_AttributeInfo & ResultAttributeInfo,
             TArray< FString > & AttributeData, int32 TupleSize = 0 ) const;
 
+        /** HAPI: Get attribute string handles on a specified owner, without resolving them. **/
+        bool HapiGetAttributeDataAsStringHandles(
+            HAPI_NodeId OtherAssetId, const char * AttributeName,
+            HAPI_AttributeOwner AttributeOwner, HAPI_AttributeInfo & ResultAttributeInfo,
+            TArray< HAPI_StringHandle > & AttributeData ) const;
+
         /** HAPI: Get attribute string data on any owner. **/
         bool HapiGetAttributeDataAsString(
             HAPI_NodeId OtherAssetId, const char * AttributeName,
@@ -60,6 +60,9 @@ UHoudiniInstancedActorComponent::Serialize( FArchive & Ar )
 
     Ar << InstancedAsset;
     Ar << Instances;
+
+    if ( Ar.IsLoading() )
+        InstancesAsset = InstancedAsset;
 }
 
 void 
@@ -80,19 +83,50 @@ UHoudiniInstancedActorComponent::SetInstances( const TArray<FTransform>& Instanc
     {
         const FScopedTransaction Transaction( LOCTEXT( "UpdateInstances", "Update Instances" ) );
         GetOwner()->Modify();
-        ClearInstances();
 
-        if( InstancedAsset )
+        if( !InstancedAsset )
         {
-            for( const FTransform& InstanceTransform : InstanceTransforms )
-            {
-                AddInstance( InstanceTransform );
-            }
+            ClearInstances();
+            HOUDINI_LOG_ERROR( TEXT( "%s: Null InstancedAsset for instanced actor override" ), *GetOwner()->GetName() );
+            return;
         }
-        else
+
+        // Actors spawned from another asset cannot be reused.
+        if ( InstancesAsset.Get() != InstancedAsset )
+            ClearInstances();
+
+        // Drop actors which have been deleted by the user.
+        Instances.RemoveAll( []( AActor * Instance ) { return !Instance || Instance->IsPendingKill(); } );
+
+        // Destroy surplus actors.
+        for ( int32 Idx = Instances.Num() - 1; Idx >= InstanceTransforms.Num(); --Idx )
+            Instances[ Idx ]->Destroy();
+
+        if ( Instances.Num() > InstanceTransforms.Num() )
+            Instances.SetNum( InstanceTransforms.Num() );
+
+        // Reposition the actors we keep, only touching the ones that moved.
+        for ( int32 Idx = 0; Idx < Instances.Num(); ++Idx )
         {
-            HOUDINI_LOG_ERROR( TEXT( "%s: Null InstancedAsset for instanced actor override" ), *GetOwner()->GetName() );
+            AActor * Instance = Instances[ Idx ];
+            const FTransform & InstanceTransform = InstanceTransforms[ Idx ];
+
+            USceneComponent * InstanceRootComponent = Instance->GetRootComponent();
+            if ( InstanceRootComponent &&
+                InstanceRootComponent->GetAttachParent() == this &&
+                InstanceRootComponent->GetRelativeTransform().Equals( InstanceTransform ) )
+                continue;
+
+            Instance->Modify();
+            Instance->AttachToComponent( this, FAttachmentTransformRules::KeepRelativeTransform );
+            Instance->SetActorRelativeTransform( InstanceTransform );
         }
+
+        // Spawn the additional actors.
+        for ( int32 Idx = Instances.Num(); Idx < InstanceTransforms.Num(); ++Idx )
+            AddInstance( InstanceTransforms[ Idx ] );
+
+        InstancesAsset = InstancedAsset;
     }
 #endif
 }
@@ -104,6 +138,7 @@ UHoudiniInstancedActorComponent::AddInstance( const FTransform& InstanceTransfor
     {
         NewActor->AttachToComponent( this, FAttachmentTransformRules::KeepRelativeTransform );
         NewActor->SetActorRelativeTransform( InstanceTransform );
+        InstancesAsset = InstancedAsset;
         return Instances.Add( NewActor );
     }
     return -1;
@@ -133,6 +168,7 @@ UHoudiniInstancedActorComponent::ClearInstances()
         }
     }
     Instances.Empty();
+    InstancesAsset.Reset();
 }
 
 
@@ -47,7 +47,8 @@ public:
 
     static void AddReferencedObjects( UObject * InThis, FReferenceCollector & Collector );
     
-    /** Set the instances. Transforms are given in local space of this component. */
+    /** Set the instances. Transforms are given in local space of this component.
+        Existing actors are reused and repositioned, only missing actors are spawned. */
     void SetInstances( const TArray<FTransform>& InstanceTransforms );
 
     /** Add an instance to this component. Transform is given in local space of this component. */
@@ -65,4 +66,9 @@ public:
     UPROPERTY( SkipSerialization, VisibleInstanceOnly, Category = Instances )
     TArray< AActor* > Instances;
 
+protected:
+
+    /** Asset the current instances were spawned from, they can only be reused while it matches InstancedAsset. */
+    TWeakObjectPtr< UObject > InstancesAsset;
+
 };
@@ -36,6 +36,123 @@
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineString.h"
+#include "Async/ParallelFor.h"
+#include "Async/Async.h"
+
+#if WITH_EDITOR
+#include "LandscapeInfo.h"
+#include "LandscapeEdit.h"
+#include "LandscapeComponent.h"
+#endif
+
+// Computes the factors used to convert Houdini's float heights to unreal's uint16 digits
+static void
+GetLandscapeDigitConversion(
+    const float& FloatMin, const float& FloatMax,
+    double& MeterZRange, double& DigitZRange,
+    double& DigitCenterOffset, double& ZSpacing )
+{
+    // The ZRange in Houdini (in m)
+    MeterZRange = (double) ( FloatMax - FloatMin );
+
+    // The corresponding unreal digit range (as unreal uses uint16, max is 65535)
+    // We may want to not use the full range in order to be able to sculpt the landscape past the min/max values after.
+    DigitZRange = 49152.0;
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings && HoudiniRuntimeSettings->MarshallingLandscapesUseFullResolution )
+        DigitZRange = 65535.0;
+
+    // If we  are not using the full range, we need to center the digit values so the terrain can be edited up and down
+    DigitCenterOffset = FMath::FloorToDouble( ( 65535.0 - DigitZRange ) / 2.0 );
+
+    // The factor used to convert from Houdini's ZRange to the desired digit range
+    ZSpacing = ( MeterZRange != 0.0 ) ? ( DigitZRange / MeterZRange ) : 0.0;
+}
+
+// Converts a single Houdini height value to an unreal digit
+static FORCEINLINE uint16
+ConvertHeightValueToDigit(
+    const float& Value, const float& FloatMin,
+    const double& ZSpacing, const double& DigitCenterOffset )
+{
+    // Get the double values in [0 - ZRange]
+    double DoubleValue = (double)Value - (double)FloatMin;
+
+    // Then convert it to [0 - DesiredRange] and center it
+    DoubleValue = DoubleValue * ZSpacing + DigitCenterOffset;
+
+    //dValue = FMath::Clamp(dValue, 0.0, 65535.0);
+    return FMath::RoundToInt( DoubleValue );
+}
+
+// Converts a single Houdini layer value to an unreal weight
+static FORCEINLINE uint8
+ConvertLayerValueToWeight( const float& Value, const float& LayerMin, const double& LayerZSpacing )
+{
+    // Get the double values in [0 - ZRange]
+    double DoubleValue = (double)Value - (double)LayerMin;
+
+    // Then convert it to [0 - 255]
+    DoubleValue *= LayerZSpacing;
+
+    return FMath::RoundToInt( DoubleValue );
+}
+
+// Quantizes a chunk of Houdini rows to unreal digits. The height data is transposed for unreal, so Houdini's
+// rows [YStart, YStart + YCount[ are the unreal columns of the same indices.
+static void
+QuantizeHeightfieldRows(
+    const float * RowValues, const int32& YStart, const int32& YCount,
+    const int32& HoudiniXSize, const int32& HoudiniYSize,
+    const float& FloatMin, const double& ZSpacing, const double& DigitCenterOffset,
+    uint16 * IntHeightData )
+{
+    const int32 XSize = HoudiniYSize;
+    const int32 YSize = HoudiniXSize;
+
+    // The transposition is done by square blocks so that both the reads and the writes stay in cache.
+    // Each task handles a band of unreal rows, so no two tasks write to the same values.
+    const int32 BlockSize = HAPI_UNREAL_LANDSCAPE_CONVERSION_BLOCK_SIZE;
+    const int32 NumRowBlocks = ( YSize + BlockSize - 1 ) / BlockSize;
+    ParallelFor( NumRowBlocks, [&]( int32 RowBlock )
+    {
+        const int32 StartY = RowBlock * BlockSize;
+        const int32 EndY = FMath::Min( StartY + BlockSize, YSize );
+        for ( int32 StartX = YStart; StartX < YStart + YCount; StartX += BlockSize )
+        {
+            const int32 EndX = FMath::Min( StartX + BlockSize, YStart + YCount );
+            for ( int32 nX = StartX; nX < EndX; nX++ )
+            {
+                // We need to invert X/Y when reading the value from Houdini,
+                // a column of the unreal block is a contiguous row in Houdini
+                const float * HoudiniRow = RowValues + ( nX - YStart ) * HoudiniXSize;
+                for ( int32 nY = StartY; nY < EndY; nY++ )
+                {
+                    IntHeightData[ nX + nY * XSize ] = ConvertHeightValueToDigit(
+                        HoudiniRow[ nY ], FloatMin, ZSpacing, DigitCenterOffset );
+                }
+            }
+        }
+    }, NumRowBlocks == 1 );
+}
+
+// Quantizes a chunk of Houdini layer rows to unreal weights. Layers are not transposed like the height,
+// only their X axis is inverted, so rows are independent.
+static void
+QuantizeHeightfieldLayerRows(
+    const float * RowValues, const int32& YStart, const int32& YCount,
+    const int32& LayerXSize,
+    const float& LayerMin, const double& LayerZSpacing,
+    uint8 * LayerData )
+{
+    ParallelFor( YCount, [&]( int32 RowIdx )
+    {
+        uint8 * UnrealRow = LayerData + ( YStart + RowIdx ) * LayerXSize;
+        const float * HoudiniRow = RowValues + RowIdx * LayerXSize;
+        for ( int32 nX = 0; nX < LayerXSize; nX++ )
+            UnrealRow[ nX ] = ConvertLayerValueToWeight( HoudiniRow[ LayerXSize - 1 - nX ], LayerMin, LayerZSpacing );
+    } );
+}
 
 void
 FHoudiniLandscapeUtils::GetHeightfieldsInArray(
@@ -194,7 +311,7 @@ FHoudiniLandscapeUtils::CalcHeightfieldsArrayGlobalZMinZMax(
     fGlobalMax = 0.0f;
 
     // TODO: Replace this unoptimized version with the proper HAPI call when available!
-    // We need to know the global min/max for all hieghtfield found in order to convert the landscapes accurately    
+    // We need to know the global min/max for all hieghtfield found in order to convert the landscapes accurately
     bool bMinMaxSet = false;
     for ( TArray< const FHoudiniGeoPartObject* >::TConstIterator IterHeighfields( InHeightfieldArray ); IterHeighfields; ++IterHeighfields )
     {
@@ -203,84 +320,34 @@ FHoudiniLandscapeUtils::CalcHeightfieldsArrayGlobalZMinZMax(
         if ( !CurrentHeightfield )
             continue;
 
-        if ( !CurrentHeightfield->IsVolume() )
-            continue;
-
-        // Retrieve node id from geo part.
-        HAPI_NodeId NodeId = CurrentHeightfield->HapiGeoGetNodeId();
-        if ( NodeId == -1 )
-            continue;
-
-        // Retrieve the VolumeInfo
         HAPI_VolumeInfo CurrentVolumeInfo;
-        if ( HAPI_RESULT_SUCCESS != FHoudiniApi::GetVolumeInfo(
-            FHoudiniEngine::Get().GetSession(),
-            NodeId, CurrentHeightfield->PartId,
-            &CurrentVolumeInfo ) )
-            continue;
-
-        // We're only handling single values for now
-        if ( CurrentVolumeInfo.tupleSize != 1 )
-            continue;
-
-        // Terrains always have a ZSize of 1.
-        if ( CurrentVolumeInfo.zLength != 1 )
-            continue;
-
-        // Values should be float
-        if ( CurrentVolumeInfo.storage != HAPI_STORAGETYPE_FLOAT )
-            continue;
-
-        int32 XSize = CurrentVolumeInfo.xLength;
-        int32 YSize = CurrentVolumeInfo.yLength;
-        int32 SizeInPoints = XSize * YSize;
-        int32 TotalSize = SizeInPoints * CurrentVolumeInfo.tupleSize;
-
-        if ( ( XSize < 2 ) || ( YSize < 2 ) )
+        if ( !GetHeightfieldVolumeInfo( *CurrentHeightfield, CurrentVolumeInfo ) )
             continue;
 
-        int32 XOffset = CurrentVolumeInfo.minX;
-        int32 YOffset = CurrentVolumeInfo.minY;
-
-        TArray<float> FloatHeightData;
-        FloatHeightData.SetNumUninitialized( TotalSize );
-
-        // Get all the heightfield data
-        if ( HAPI_RESULT_SUCCESS != FHoudiniApi::GetHeightFieldData(
-            FHoudiniEngine::Get().GetSession(),
-            NodeId, CurrentHeightfield->PartId,
-            FloatHeightData.GetData(),
-            0, SizeInPoints ) )
+        // The values are streamed by chunks of rows so the heightfield is never fully in memory
+        float CurrentMin = 0.0f, CurrentMax = 0.0f;
+        if ( !GetHeightfieldMinMax( *CurrentHeightfield, CurrentVolumeInfo, CurrentMin, CurrentMax ) )
             continue;
 
-        // We will need the min and max value for the conversion to uint16
         if ( !bMinMaxSet )
         {
-            fGlobalMin = FloatHeightData[ 0 ];
-            fGlobalMax = fGlobalMin;
+            fGlobalMin = CurrentMin;
+            fGlobalMax = CurrentMax;
             bMinMaxSet = true;
         }
-
-        for ( int32 n = 0; n < SizeInPoints; n++ )
+        else
         {
-            if ( FloatHeightData[ n ] > fGlobalMax )
-                fGlobalMax = FloatHeightData[ n ];
-            else if ( FloatHeightData[ n ] < fGlobalMin )
-                fGlobalMin = FloatHeightData[ n ];
+            fGlobalMin = FMath::Min( fGlobalMin, CurrentMin );
+            fGlobalMax = FMath::Max( fGlobalMax, CurrentMax );
         }
     }
 }
 
-bool FHoudiniLandscapeUtils::ExtractHeightfieldData(
+bool
+FHoudiniLandscapeUtils::GetHeightfieldVolumeInfo(
     const FHoudiniGeoPartObject& Heightfield,
-    TArray<float>& FloatValues,
-    HAPI_VolumeInfo& VolumeInfo,
-    float& FloatMin, float& FloatMax )
+    HAPI_VolumeInfo& VolumeInfo )
 {
-    FloatValues.Empty();
-    FloatMin = 0.0f;
-    FloatMax = 0.0f;
-
     if ( !Heightfield.IsVolume() )
         return false;
 
@@ -310,45 +377,175 @@ bool FHoudiniLandscapeUtils::ExtractHeightfieldData(
     if ( ( VolumeInfo.xLength < 2 ) || ( VolumeInfo.yLength < 2 ) )
         return false;
 
-    int32 SizeInPoints = VolumeInfo.xLength *  VolumeInfo.yLength;
-    int32 TotalSize = SizeInPoints * VolumeInfo.tupleSize;
+    return true;
+}
 
-    //--------------------------------------------------------------------------------------------------
-    // 1. Reading and converting the Height values from HAPI
-    //--------------------------------------------------------------------------------------------------    
-    FloatValues.SetNumUninitialized( TotalSize );
+bool
+FHoudiniLandscapeUtils::ForEachHeightfieldRows(
+    const FHoudiniGeoPartObject& Heightfield,
+    const HAPI_VolumeInfo& VolumeInfo,
+    TFunctionRef< void( int32 YStart, int32 YCount, const float * RowValues ) > RowsFunction )
+{
+    HAPI_NodeId NodeId = Heightfield.HapiGeoGetNodeId();
+    if ( NodeId == -1 )
+        return false;
 
-    // Get all the heightfield data
-    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetHeightFieldData(
-        FHoudiniEngine::Get().GetSession(),
-        NodeId, Heightfield.PartId,
-        FloatValues.GetData(),
-        0, SizeInPoints ), false );
-
-    // We will need the min and max value for the conversion to uint16
-    FloatMin = FloatValues[0];
-    FloatMax = FloatMin;
-    for ( int32 n = 0; n < SizeInPoints; n++ )
-    {
-        if ( FloatValues[ n ] > FloatMax )
-            FloatMax = FloatValues[ n ];
-        else if ( FloatValues[ n ] < FloatMin )
-            FloatMin = FloatValues[ n ];
+    const int32 XSize = VolumeInfo.xLength;
+    const int32 YSize = VolumeInfo.yLength;
+    if ( ( XSize <= 0 ) || ( YSize <= 0 ) )
+        return false;
+
+    const int32 RowsPerChunk = FMath::Clamp( HAPI_UNREAL_HEIGHTFIELD_TRANSFER_CHUNK_SIZE / XSize, 1, YSize );
+
+    // The rows are read in two chunk sized buffers: while a chunk is processed on a worker, the next one is
+    // fetched on this thread. Chunks are still processed one at a time and in order.
+    TArray< float > ChunkValues[ 2 ];
+    ChunkValues[ 0 ].SetNumUninitialized( RowsPerChunk * XSize );
+    ChunkValues[ 1 ].SetNumUninitialized( RowsPerChunk * XSize );
+
+    TFuture< void > PendingRows;
+    int32 ChunkIdx = 0;
+    for ( int32 YStart = 0; YStart < YSize; YStart += RowsPerChunk, ++ChunkIdx )
+    {
+        const int32 YCount = FMath::Min( RowsPerChunk, YSize - YStart );
+        float * RowValues = ChunkValues[ ChunkIdx % 2 ].GetData();
+
+        const HAPI_Result Result = FHoudiniApi::GetHeightFieldData(
+            FHoudiniEngine::Get().GetSession(),
+            NodeId, Heightfield.PartId,
+            RowValues, YStart * XSize, YCount * XSize );
+
+        if ( PendingRows.IsValid() )
+            PendingRows.Wait();
+
+        if ( Result != HAPI_RESULT_SUCCESS )
+        {
+            HOUDINI_LOG_ERROR( TEXT( "Hapi failed: %s" ), *FHoudiniEngineUtils::GetErrorDescription() );
+            return false;
+        }
+
+        PendingRows = Async< void >( EAsyncExecution::TaskGraph, [ &RowsFunction, YStart, YCount, RowValues ]()
+        {
+            RowsFunction( YStart, YCount, RowValues );
+        } );
     }
 
+    PendingRows.Wait();
+
     return true;
 }
 
 bool
-FHoudiniLandscapeUtils::ConvertHeightfieldDataToLandscapeData(
-    const TArray<float>& HeightfieldFloatValues,
-    const HAPI_VolumeInfo& HeightfieldVolumeInfo,
+FHoudiniLandscapeUtils::GetHeightfieldMinMax(
+    const FHoudiniGeoPartObject& Heightfield,
+    const HAPI_VolumeInfo& VolumeInfo,
+    float& FloatMin, float& FloatMax )
+{
+    FloatMin = 0.0f;
+    FloatMax = 0.0f;
+
+    bool bMinMaxSet = false;
+    bool bSuccess = ForEachHeightfieldRows(
+        Heightfield, VolumeInfo,
+        [&]( int32 YStart, int32 YCount, const float * RowValues )
+        {
+            if ( !bMinMaxSet )
+            {
+                FloatMin = RowValues[ 0 ];
+                FloatMax = FloatMin;
+                bMinMaxSet = true;
+            }
+
+            const int32 NumValues = YCount * VolumeInfo.xLength;
+            for ( int32 n = 0; n < NumValues; n++ )
+            {
+                FloatMin = FMath::Min( FloatMin, RowValues[ n ] );
+                FloatMax = FMath::Max( FloatMax, RowValues[ n ] );
+            }
+        } );
+
+    return bSuccess && bMinMaxSet;
+}
+
+bool
+FHoudiniLandscapeUtils::GetHeightfieldDataMinMax(
+    const TArray< float >& FloatValues,
+    float& FloatMin, float& FloatMax )
+{
+    FloatMin = 0.0f;
+    FloatMax = 0.0f;
+
+    const int32 NumValues = FloatValues.Num();
+    if ( NumValues <= 0 )
+        return false;
+
+    // Each chunk computes both its min and max in a single pass, the partial results are then reduced.
+    // Min/Max are exact, so the result doesn't depend on the order of the reduction.
+    const int32 ChunkSize = HAPI_UNREAL_LANDSCAPE_MINMAX_CHUNK_SIZE;
+    const int32 NumChunks = ( NumValues + ChunkSize - 1 ) / ChunkSize;
+
+    TArray< float > ChunkMins, ChunkMaxs;
+    ChunkMins.SetNumUninitialized( NumChunks );
+    ChunkMaxs.SetNumUninitialized( NumChunks );
+
+    const float * Values = FloatValues.GetData();
+    ParallelFor( NumChunks, [&]( int32 ChunkIndex )
+    {
+        const int32 Start = ChunkIndex * ChunkSize;
+        const int32 End = FMath::Min( Start + ChunkSize, NumValues );
+
+        float ChunkMin = Values[ Start ];
+        float ChunkMax = ChunkMin;
+        for ( int32 n = Start + 1; n < End; n++ )
+        {
+            ChunkMin = FMath::Min( ChunkMin, Values[ n ] );
+            ChunkMax = FMath::Max( ChunkMax, Values[ n ] );
+        }
+
+        ChunkMins[ ChunkIndex ] = ChunkMin;
+        ChunkMaxs[ ChunkIndex ] = ChunkMax;
+    }, NumChunks == 1 );
+
+    FloatMin = ChunkMins[ 0 ];
+    FloatMax = ChunkMaxs[ 0 ];
+    for ( int32 n = 1; n < NumChunks; n++ )
+    {
+        FloatMin = FMath::Min( FloatMin, ChunkMins[ n ] );
+        FloatMax = FMath::Max( FloatMax, ChunkMaxs[ n ] );
+    }
+
+    return true;
+}
+
+void
+FHoudiniLandscapeUtils::QuantizeHeightfieldData(
+    const float * HeightfieldFloatValues,
+    const int32& HoudiniXSize, const int32& HoudiniYSize,
     const float& FloatMin, const float& FloatMax,
-    TArray<uint16>& IntHeightData,
+    TArray< uint16 >& IntHeightData )
+{
+    double MeterZRange, DigitZRange, DigitCenterOffset, ZSpacing;
+    GetLandscapeDigitConversion( FloatMin, FloatMax, MeterZRange, DigitZRange, DigitCenterOffset, ZSpacing );
+
+    // Converting the data from Houdini to Unreal
+    // For correct orientation in unreal, the point matrix has to be transposed.
+    IntHeightData.SetNumUninitialized( HoudiniXSize * HoudiniYSize );
+    QuantizeHeightfieldRows(
+        HeightfieldFloatValues, 0, HoudiniYSize, HoudiniXSize, HoudiniYSize,
+        FloatMin, ZSpacing, DigitCenterOffset, IntHeightData.GetData() );
+}
+
+bool
+FHoudiniLandscapeUtils::ExtractHeightfieldLandscapeData(
+    const FHoudiniGeoPartObject& Heightfield,
+    const HAPI_VolumeInfo& HeightfieldVolumeInfo,
+    const float& GlobalMin, const float& GlobalMax,
+    TArray< uint16 >& IntHeightData,
     FTransform& LandscapeTransform,
     int32& FinalXSize, int32& FinalYSize,
     int32& NumSectionPerLandscapeComponent,
-    int32& NumQuadsPerLandscapeSection )
+    int32& NumQuadsPerLandscapeSection,
+    bool bTiled )
 {
     IntHeightData.Empty();
     LandscapeTransform.SetIdentity();
@@ -359,10 +556,52 @@ FHoudiniLandscapeUtils::ConvertHeightfieldDataToLandscapeData(
 
     int32 HoudiniXSize = HeightfieldVolumeInfo.xLength;
     int32 HoudiniYSize = HeightfieldVolumeInfo.yLength;
-    int32 SizeInPoints = HoudiniXSize * HoudiniYSize;
     if ( ( HoudiniXSize < 2 ) || ( HoudiniYSize < 2 ) )
         return false;
 
+    // Heightfields sharing a global range are converted with it, otherwise a first pass streams the heightfield
+    // for its own range. Either way, the values are then quantized as they are streamed, a chunk of rows at a time.
+    float FloatMin = GlobalMin, FloatMax = GlobalMax;
+    if ( GlobalMin == GlobalMax && !GetHeightfieldMinMax( Heightfield, HeightfieldVolumeInfo, FloatMin, FloatMax ) )
+        return false;
+
+    double MeterZRange, DigitZRange, DigitCenterOffset, ZSpacing;
+    GetLandscapeDigitConversion( FloatMin, FloatMax, MeterZRange, DigitZRange, DigitCenterOffset, ZSpacing );
+
+    // For correct orientation in unreal, the point matrix has to be transposed.
+    IntHeightData.SetNumUninitialized( HoudiniXSize * HoudiniYSize );
+    uint16 * IntHeightDataPtr = IntHeightData.GetData();
+    if ( !ForEachHeightfieldRows(
+        Heightfield, HeightfieldVolumeInfo,
+        [&]( int32 YStart, int32 YCount, const float * RowValues )
+        {
+            QuantizeHeightfieldRows(
+                RowValues, YStart, YCount, HoudiniXSize, HoudiniYSize,
+                FloatMin, ZSpacing, DigitCenterOffset, IntHeightDataPtr );
+        } ) )
+    {
+        IntHeightData.Empty();
+        return false;
+    }
+
+    return FinalizeLandscapeHeightData(
+        IntHeightData, HeightfieldVolumeInfo, FloatMin, FloatMax,
+        LandscapeTransform, FinalXSize, FinalYSize,
+        NumSectionPerLandscapeComponent, NumQuadsPerLandscapeSection,
+        bTiled );
+}
+
+bool
+FHoudiniLandscapeUtils::FinalizeLandscapeHeightData(
+    TArray< uint16 >& IntHeightData,
+    const HAPI_VolumeInfo& HeightfieldVolumeInfo,
+    const float& FloatMin, const float& FloatMax,
+    FTransform& LandscapeTransform,
+    int32& FinalXSize, int32& FinalYSize,
+    int32& NumSectionPerLandscapeComponent,
+    int32& NumQuadsPerLandscapeSection,
+    bool bTiled )
+{
     // Test for potential special cases...
     // Just print a warning for now
     if ( HeightfieldVolumeInfo.minX != 0 )
@@ -371,50 +610,14 @@ FHoudiniLandscapeUtils::ConvertHeightfieldDataToLandscapeData(
     if ( HeightfieldVolumeInfo.minY != 0 )
         HOUDINI_LOG_WARNING( TEXT( "Converting Landscape: heightfield's min Y is not zero." ) );
 
-    //--------------------------------------------------------------------------------------------------
-    // 1. Convert values to uint16 using doubles to get the maximum precision during the conversion
-    //--------------------------------------------------------------------------------------------------
-
-    // The ZRange in Houdini (in m)
-    double MeterZRange = (double) ( FloatMax - FloatMin );
-
-    // The corresponding unreal digit range (as unreal uses uint16, max is 65535)
-    // We may want to not use the full range in order to be able to sculpt the landscape past the min/max values after.
-    double DigitZRange = 49152.0;
-    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
-    if ( HoudiniRuntimeSettings && HoudiniRuntimeSettings->MarshallingLandscapesUseFullResolution )
-        DigitZRange = 65535.0;
-
-    // If we  are not using the full range, we need to center the digit values so the terrain can be edited up and down
-    double DigitCenterOffset = FMath::FloorToDouble( ( 65535.0 - DigitZRange ) / 2.0 );
-
-    // The factor used to convert from Houdini's ZRange to the desired digit range
-    double ZSpacing = ( MeterZRange != 0.0 ) ? ( DigitZRange / MeterZRange ) : 0.0;
-
-    // Converting the data from Houdini to Unreal
-    // For correct orientation in unreal, the point matrix has to be transposed.
-    int32 XSize = HoudiniYSize;
-    int32 YSize = HoudiniXSize;
-    IntHeightData.SetNumUninitialized( SizeInPoints );
-
-    for ( int32 nY = 0; nY < YSize; nY++ )
-    {
-        for ( int32 nX = 0; nX < XSize; nX++ )
-        {
-            // We need to invert X/Y when reading the value from Houdini
-            int32 nUnreal = nX + nY * XSize;
-            int32 nHoudini = nY + nX * HoudiniXSize;
-
-            // Get the double values in [0 - ZRange]
-            double DoubleValue = (double)HeightfieldFloatValues[ nHoudini ] - (double)FloatMin;
-
-            // Then convert it to [0 - DesiredRange] and center it 
-            DoubleValue = DoubleValue * ZSpacing + DigitCenterOffset;
+    // The height data has already been transposed to unreal's orientation
+    int32 XSize = HeightfieldVolumeInfo.yLength;
+    int32 YSize = HeightfieldVolumeInfo.xLength;
+    if ( IntHeightData.Num() != XSize * YSize )
+        return false;
 
-            //dValue = FMath::Clamp(dValue, 0.0, 65535.0);
-            IntHeightData[ nUnreal ] = FMath::RoundToInt( DoubleValue );
-        }
-    }
+    double MeterZRange, DigitZRange, DigitCenterOffset, ZSpacing;
+    GetLandscapeDigitConversion( FloatMin, FloatMax, MeterZRange, DigitZRange, DigitCenterOffset, ZSpacing );
 
     //--------------------------------------------------------------------------------------------------
     // 2. Resample / Pad the int data so that if fits unreal size requirements
@@ -427,7 +630,16 @@ FHoudiniLandscapeUtils::ConvertHeightfieldDataToLandscapeData(
     NumSectionPerLandscapeComponent = 1;
     NumQuadsPerLandscapeSection = XSize - 1;
     FVector LandscapeResizeFactor = FVector( 1.0f, 1.0f, 1.0f );
-    if ( !FHoudiniLandscapeUtils::ResizeHeightDataForLandscape(
+    if ( bTiled )
+    {
+        // Tiled landscapes keep their full resolution and are only padded.
+        if ( !FHoudiniLandscapeUtils::ResizeHeightDataForLandscapeTiles(
+            IntHeightData, XSize, YSize,
+            NumSectionPerLandscapeComponent,
+            NumQuadsPerLandscapeSection ) )
+            return false;
+    }
+    else if ( !FHoudiniLandscapeUtils::ResizeHeightDataForLandscape(
         IntHeightData, XSize, YSize,
         NumSectionPerLandscapeComponent,
         NumQuadsPerLandscapeSection,
@@ -544,37 +756,41 @@ FHoudiniLandscapeUtils::ConvertHeightfieldDataToLandscapeData(
     return true;
 }
 
-bool FHoudiniLandscapeUtils::ConvertHeightfieldLayerToLandscapeLayer(
-    const TArray<float>& FloatLayerData,
-    const int32& LayerXSize, const int32& LayerYSize,
-    const float& LayerMin, const float& LayerMax,
+bool
+FHoudiniLandscapeUtils::ExtractHeightfieldLayerData(
+    const FHoudiniGeoPartObject& Layer,
+    const HAPI_VolumeInfo& LayerVolumeInfo,
     const int32& LandscapeXSize, const int32& LandscapeYSize,
-    TArray<uint8>& LayerData )
+    TArray< uint8 >& LayerData,
+    float& LayerMin, float& LayerMax )
 {
-    // Convert the float data to uint8
-    LayerData.SetNumUninitialized( LayerXSize * LayerYSize );
+    LayerData.Empty();
 
-    // Calculating the factor used to convert from Houdini's ZRange to [0 255]
-    double LayerZRange = ( LayerMax - LayerMin );
-    double LayerZSpacing = ( LayerZRange != 0.0 ) ? ( 255.0 / (double)( LayerMax - LayerMin ) ) : 0.0;
-
-    int32 nUnrealIndex = 0;
-    for ( int32 nY = 0; nY < LayerYSize; nY++ )
-    {
-        for ( int32 nX = 0; nX < LayerXSize; nX++ )
-        {
-            // Inverts the values from Houdini
-            int32 nHoudini = ( LayerXSize - 1 - nX ) + ( ( nY )* LayerXSize );
+    // A first pass streams the layer for its range
+    if ( !GetHeightfieldMinMax( Layer, LayerVolumeInfo, LayerMin, LayerMax ) )
+        return false;
 
-            // Get the double values in [0 - ZRange]
-            double DoubleValue = (double)FloatLayerData[ nHoudini ] - (double)LayerMin;
+    // No need to convert flat layers as Unreal will remove them afterwards..
+    if ( LayerMin == LayerMax )
+        return true;
 
-            // Then convert it to [0 - 255]
-            DoubleValue *= LayerZSpacing;
+    // Calculating the factor used to convert from Houdini's ZRange to [0 255]
+    const double LayerZSpacing = 255.0 / (double)( LayerMax - LayerMin );
 
-            //dValue = FMath::Clamp(dValue, 0.0, 65535.0);
-            LayerData[ nUnrealIndex++ ] = FMath::RoundToInt( DoubleValue );
-        }
+    // The values are then quantized as they are streamed, a chunk of rows at a time
+    int32 LayerXSize = LayerVolumeInfo.xLength;
+    int32 LayerYSize = LayerVolumeInfo.yLength;
+    LayerData.SetNumUninitialized( LayerXSize * LayerYSize );
+    uint8 * LayerDataPtr = LayerData.GetData();
+    if ( !ForEachHeightfieldRows(
+        Layer, LayerVolumeInfo,
+        [&]( int32 YStart, int32 YCount, const float * RowValues )
+        {
+            QuantizeHeightfieldLayerRows( RowValues, YStart, YCount, LayerXSize, LayerMin, LayerZSpacing, LayerDataPtr );
+        } ) )
+    {
+        LayerData.Empty();
+        return false;
     }
 
     // Finally, we need to resize the data to fit with the new landscape size
@@ -600,7 +816,7 @@ void ExpandData(T* OutData, const T* InData,
     const int32 OffsetX = NewMinX - OldMinX;
     const int32 OffsetY = NewMinY - OldMinY;
 
-    for (int32 Y = 0; Y < NewHeight; ++Y)
+    ParallelFor(NewHeight, [&](int32 Y)
     {
         const int32 OldY = FMath::Clamp<int32>(Y + OffsetY, 0, OldHeight - 1);
 
@@ -623,7 +839,7 @@ void ExpandData(T* OutData, const T* InData,
         {
             OutData[Y * NewWidth + X] = PadRight;
         }
-    }
+    });
 }
 
 template<typename T>
@@ -654,23 +870,26 @@ TArray<T> ResampleData(const TArray<T>& Data, int32 OldWidth, int32 OldHeight, i
 
     const float XScale = (float)(OldWidth - 1) / (NewWidth - 1);
     const float YScale = (float)(OldHeight - 1) / (NewHeight - 1);
-    for (int32 Y = 0; Y < NewHeight; ++Y)
+
+    // Every output row only depends on the source data, so the rows are resampled in parallel
+    const T* InData = Data.GetData();
+    T* OutData = Result.GetData();
+    ParallelFor(NewHeight, [&](int32 Y)
     {
+        const float OldY = Y * YScale;
+        const int32 Y0 = FMath::FloorToInt(OldY);
+        const int32 Y1 = FMath::Min(FMath::FloorToInt(OldY) + 1, OldHeight - 1);
+        const T* Row0 = InData + Y0 * OldWidth;
+        const T* Row1 = InData + Y1 * OldWidth;
+        T* OutRow = OutData + Y * NewWidth;
         for (int32 X = 0; X < NewWidth; ++X)
         {
-            const float OldY = Y * YScale;
             const float OldX = X * XScale;
             const int32 X0 = FMath::FloorToInt(OldX);
             const int32 X1 = FMath::Min(FMath::FloorToInt(OldX) + 1, OldWidth - 1);
-            const int32 Y0 = FMath::FloorToInt(OldY);
-            const int32 Y1 = FMath::Min(FMath::FloorToInt(OldY) + 1, OldHeight - 1);
-            const T& Original00 = Data[Y0 * OldWidth + X0];
-            const T& Original10 = Data[Y0 * OldWidth + X1];
-            const T& Original01 = Data[Y1 * OldWidth + X0];
-            const T& Original11 = Data[Y1 * OldWidth + X1];
-            Result[Y * NewWidth + X] = FMath::BiLerp(Original00, Original10, Original01, Original11, FMath::Fractional(OldX), FMath::Fractional(OldY));
+            OutRow[X] = FMath::BiLerp(Row0[X0], Row0[X1], Row1[X0], Row1[X1], FMath::Fractional(OldX), FMath::Fractional(OldY));
         }
-    }
+    });
 
     return Result;
 }
@@ -845,6 +1064,59 @@ FHoudiniLandscapeUtils::ResizeHeightDataForLandscape(
     return true;
 }
 
+bool
+FHoudiniLandscapeUtils::ResizeHeightDataForLandscapeTiles(
+    TArray< uint16 >& HeightData,
+    int32& SizeX, int32& SizeY,
+    int32& NumberOfSectionsPerComponent,
+    int32& NumberOfQuadsPerSection )
+{
+    if ( ( SizeX < 2 ) || ( SizeY < 2 ) )
+        return false;
+
+    if ( HeightData.Num() != SizeX * SizeY )
+        return false;
+
+    // Use Unreal's recommended layout for large landscapes: 2x2 sections of 63 quads per component.
+    NumberOfSectionsPerComponent = 2;
+    NumberOfQuadsPerSection = 63;
+
+    const int32 QuadsPerComponent = NumberOfSectionsPerComponent * NumberOfQuadsPerSection;
+    const int32 NewSizeX = FMath::DivideAndRoundUp( SizeX - 1, QuadsPerComponent ) * QuadsPerComponent + 1;
+    const int32 NewSizeY = FMath::DivideAndRoundUp( SizeY - 1, QuadsPerComponent ) * QuadsPerComponent + 1;
+
+    if ( ( NewSizeX != SizeX ) || ( NewSizeY != SizeY ) )
+    {
+        // Expand the data by padding, the same way layers are expanded.
+        const int32 OffsetX = (int32)( NewSizeX - SizeX ) / 2;
+        const int32 OffsetY = (int32)( NewSizeY - SizeY ) / 2;
+
+        HeightData = ExpandData(
+            HeightData, 0, 0, SizeX - 1, SizeY - 1,
+            -OffsetX, -OffsetY, NewSizeX - OffsetX - 1, NewSizeY - OffsetY - 1 );
+
+        SizeX = NewSizeX;
+        SizeY = NewSizeY;
+    }
+
+    return true;
+}
+
+bool
+FHoudiniLandscapeUtils::ShouldTileLandscape( const HAPI_VolumeInfo& VolumeInfo, int32& TileSize )
+{
+    TileSize = HAPI_UNREAL_LANDSCAPE_TILE_SIZE_DEFAULT;
+    const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+    if ( HoudiniRuntimeSettings )
+        TileSize = HoudiniRuntimeSettings->MarshallingLandscapesTileSize;
+
+    if ( TileSize <= 0 )
+        return false;
+
+    // Houdini's X/Y are transposed in Unreal, but tiles are square.
+    return ( VolumeInfo.xLength > TileSize ) || ( VolumeInfo.yLength > TileSize );
+}
+
 bool
 FHoudiniLandscapeUtils::ResizeLayerDataForLandscape(
     TArray< uint8 >& LayerData,
@@ -883,6 +1155,268 @@ FHoudiniLandscapeUtils::ResizeLayerDataForLandscape(
     return true;
 }
 
+#if WITH_EDITOR
+
+// Compares the new and current data of every landscape component and flags the ones that differ.
+// Components include their border vertices, which are shared with their neighbours.
+template< typename T >
+static void
+GetDirtyLandscapeComponents(
+    const TArray< T >& NewData, const TArray< T >& CurrentData,
+    const int32& XSize, const int32& NumComponentsX, const int32& NumComponentsY,
+    const int32& ComponentSizeQuads, TArray< bool >& DirtyComponents )
+{
+    DirtyComponents.Init( false, NumComponentsX * NumComponentsY );
+    ParallelFor( DirtyComponents.Num(), [&]( int32 ComponentIndex )
+    {
+        const int32 X1 = ( ComponentIndex % NumComponentsX ) * ComponentSizeQuads;
+        const int32 Y1 = ( ComponentIndex / NumComponentsX ) * ComponentSizeQuads;
+        for ( int32 nY = Y1; nY <= Y1 + ComponentSizeQuads; nY++ )
+        {
+            const int32 RowStart = X1 + nY * XSize;
+            if ( FMemory::Memcmp( &NewData[ RowStart ], &CurrentData[ RowStart ], ( ComponentSizeQuads + 1 ) * sizeof( T ) ) != 0 )
+            {
+                DirtyComponents[ ComponentIndex ] = true;
+                return;
+            }
+        }
+    } );
+}
+
+// Calls WriteFunction with the vertex bounds of each run of neighbouring dirty components on a row,
+// returns the number of dirty components.
+static int32
+ForEachDirtyLandscapeComponentRun(
+    const TArray< bool >& DirtyComponents,
+    const int32& NumComponentsX, const int32& NumComponentsY,
+    const int32& ComponentSizeQuads,
+    TFunctionRef< void( int32 X1, int32 Y1, int32 X2, int32 Y2 ) > WriteFunction )
+{
+    int32 NumDirtyComponents = 0;
+    for ( int32 CompY = 0; CompY < NumComponentsY; CompY++ )
+    {
+        int32 CompX = 0;
+        while ( CompX < NumComponentsX )
+        {
+            if ( !DirtyComponents[ CompX + CompY * NumComponentsX ] )
+            {
+                CompX++;
+                continue;
+            }
+
+            int32 RunStart = CompX;
+            while ( ( CompX < NumComponentsX ) && DirtyComponents[ CompX + CompY * NumComponentsX ] )
+                CompX++;
+
+            NumDirtyComponents += CompX - RunStart;
+            WriteFunction(
+                RunStart * ComponentSizeQuads, CompY * ComponentSizeQuads,
+                CompX * ComponentSizeQuads, ( CompY + 1 ) * ComponentSizeQuads );
+        }
+    }
+
+    return NumDirtyComponents;
+}
+
+bool
+FHoudiniLandscapeUtils::CanUpdateLandscape(
+    ALandscape * Landscape,
+    const int32& XSize, const int32& YSize,
+    const int32& NumSectionPerLandscapeComponent,
+    const int32& NumQuadsPerLandscapeSection,
+    const FTransform& LandscapeTransform )
+{
+    if ( !Landscape || Landscape->IsPendingKill() )
+        return false;
+
+    ULandscapeInfo * LandscapeInfo = Landscape->GetLandscapeInfo();
+    if ( !LandscapeInfo )
+        return false;
+
+    // Tiled landscapes are always recreated
+    if ( LandscapeInfo->Proxies.Num() > 0 )
+        return false;
+
+    // The components must have the same layout
+    if ( ( Landscape->NumSubsections != NumSectionPerLandscapeComponent )
+        || ( Landscape->SubsectionSizeQuads != NumQuadsPerLandscapeSection ) )
+        return false;
+
+    int32 MinX, MinY, MaxX, MaxY;
+    if ( !LandscapeInfo->GetLandscapeExtent( MinX, MinY, MaxX, MaxY ) )
+        return false;
+
+    if ( ( MaxX - MinX + 1 != XSize ) || ( MaxY - MinY + 1 != YSize ) )
+        return false;
+
+    // The landscape is attached to the asset component, keeping the transform it was created with as its relative transform
+    USceneComponent * LandscapeRootComponent = Landscape->GetRootComponent();
+    if ( !LandscapeRootComponent || !LandscapeRootComponent->GetRelativeTransform().Equals( LandscapeTransform ) )
+        return false;
+
+    return true;
+}
+
+bool
+FHoudiniLandscapeUtils::UpdateLandscapeData(
+    ALandscape * Landscape,
+    const TArray< uint16 >& IntHeightData,
+    const TArray< FLandscapeImportLayerInfo >& ImportLayerInfos,
+    const int32& XSize, const int32& YSize )
+{
+    ULandscapeInfo * LandscapeInfo = Landscape ? Landscape->GetLandscapeInfo() : nullptr;
+    if ( !LandscapeInfo )
+        return false;
+
+    if ( IntHeightData.Num() != XSize * YSize )
+        return false;
+
+    // The landscape must already have all the layers
+    if ( ImportLayerInfos.Num() != LandscapeInfo->Layers.Num() )
+        return false;
+
+    for ( const FLandscapeImportLayerInfo& ImportLayerInfo : ImportLayerInfos )
+    {
+        if ( !ImportLayerInfo.LayerInfo || ( ImportLayerInfo.LayerData.Num() != XSize * YSize ) )
+            return false;
+
+        if ( LandscapeInfo->GetLayerInfoIndex( ImportLayerInfo.LayerInfo ) == INDEX_NONE )
+            return false;
+    }
+
+    int32 MinX, MinY, MaxX, MaxY;
+    if ( !LandscapeInfo->GetLandscapeExtent( MinX, MinY, MaxX, MaxY ) )
+        return false;
+
+    const int32 ComponentSizeQuads = Landscape->ComponentSizeQuads;
+    if ( ComponentSizeQuads <= 0 )
+        return false;
+
+    const int32 NumComponentsX = ( XSize - 1 ) / ComponentSizeQuads;
+    const int32 NumComponentsY = ( YSize - 1 ) / ComponentSizeQuads;
+    if ( ( NumComponentsX * ComponentSizeQuads != XSize - 1 ) || ( NumComponentsY * ComponentSizeQuads != YSize - 1 ) )
+        return false;
+
+    FLandscapeEditDataInterface LandscapeEdit( LandscapeInfo );
+    TArray< bool > DirtyComponents;
+
+    // Only write the heights of the components that have changed
+    int32 NumDirtyHeightComponents = 0;
+    {
+        TArray< uint16 > CurrentHeightData;
+        CurrentHeightData.SetNumUninitialized( XSize * YSize );
+        LandscapeEdit.GetHeightDataFast( MinX, MinY, MaxX, MaxY, CurrentHeightData.GetData(), 0 );
+
+        GetDirtyLandscapeComponents(
+            IntHeightData, CurrentHeightData, XSize,
+            NumComponentsX, NumComponentsY, ComponentSizeQuads, DirtyComponents );
+
+        NumDirtyHeightComponents = ForEachDirtyLandscapeComponentRun(
+            DirtyComponents, NumComponentsX, NumComponentsY, ComponentSizeQuads,
+            [&]( int32 X1, int32 Y1, int32 X2, int32 Y2 )
+            {
+                LandscapeEdit.SetHeightData(
+                    MinX + X1, MinY + Y1, MinX + X2, MinY + Y2,
+                    &IntHeightData[ X1 + Y1 * XSize ], XSize, true );
+            } );
+    }
+
+    // Then do the same for the weights of each layer
+    int32 NumDirtyWeightComponents = 0;
+    TArray< uint8 > CurrentWeightData;
+    CurrentWeightData.SetNumUninitialized( XSize * YSize );
+    for ( const FLandscapeImportLayerInfo& ImportLayerInfo : ImportLayerInfos )
+    {
+        FMemory::Memzero( CurrentWeightData.GetData(), CurrentWeightData.Num() );
+        LandscapeEdit.GetWeightDataFast( ImportLayerInfo.LayerInfo, MinX, MinY, MaxX, MaxY, CurrentWeightData.GetData(), 0 );
+
+        GetDirtyLandscapeComponents(
+            ImportLayerInfo.LayerData, CurrentWeightData, XSize,
+            NumComponentsX, NumComponentsY, ComponentSizeQuads, DirtyComponents );
+
+        // Layers are imported as additive, so don't adjust the other layers' weights
+        NumDirtyWeightComponents += ForEachDirtyLandscapeComponentRun(
+            DirtyComponents, NumComponentsX, NumComponentsY, ComponentSizeQuads,
+            [&]( int32 X1, int32 Y1, int32 X2, int32 Y2 )
+            {
+                LandscapeEdit.SetAlphaData(
+                    ImportLayerInfo.LayerInfo,
+                    MinX + X1, MinY + Y1, MinX + X2, MinY + Y2,
+                    &ImportLayerInfo.LayerData[ X1 + Y1 * XSize ], XSize,
+                    ELandscapeLayerPaintingRestriction::None, false, false );
+            } );
+    }
+
+    LandscapeEdit.Flush();
+
+    HOUDINI_LOG_MESSAGE(
+        TEXT( "Updated landscape %s in place: %d / %d components with new heights, %d layer components with new weights." ),
+        *Landscape->GetName(), NumDirtyHeightComponents, NumComponentsX * NumComponentsY, NumDirtyWeightComponents );
+
+    return true;
+}
+
+uint32
+FHoudiniLandscapeUtils::GetLandscapeComponentHash( ULandscapeComponent * LandscapeComponent, const bool& bHashLighting )
+{
+    if ( !LandscapeComponent )
+        return 0;
+
+    // The exported geometry is in world space, and its materials are the component's overrides.
+    const FTransform& ComponentTransform = LandscapeComponent->ComponentToWorld;
+    const FVector Location = ComponentTransform.GetLocation();
+    const FQuat Rotation = ComponentTransform.GetRotation();
+    const FVector Scale = ComponentTransform.GetScale3D();
+
+    uint32 Hash = FCrc::MemCrc32( &Location, sizeof( FVector ) );
+    Hash = FCrc::MemCrc32( &Rotation, sizeof( FQuat ), Hash );
+    Hash = FCrc::MemCrc32( &Scale, sizeof( FVector ), Hash );
+    Hash = PointerHash( LandscapeComponent->OverrideMaterial, Hash );
+    Hash = PointerHash( LandscapeComponent->OverrideHoleMaterial, Hash );
+
+    // Without overrides, the exported materials are the proxy's.
+    if ( ALandscapeProxy * LandscapeProxy = LandscapeComponent->GetLandscapeProxy() )
+    {
+        Hash = PointerHash( LandscapeProxy->GetLandscapeMaterial(), Hash );
+        Hash = PointerHash( LandscapeProxy->GetLandscapeHoleMaterial(), Hash );
+    }
+
+    if ( bHashLighting )
+        Hash = PointerHash( LandscapeComponent->GetMeshMapBuildData(), Hash );
+
+    ULandscapeInfo* LandscapeInfo = LandscapeComponent->GetLandscapeInfo();
+    if ( !LandscapeInfo )
+        return Hash;
+
+    // Reading the component's heights back is much cheaper than sending them to Houdini again.
+    int32 MinX = TNumericLimits< int32 >::Max();
+    int32 MinY = TNumericLimits< int32 >::Max();
+    int32 MaxX = TNumericLimits< int32 >::Lowest();
+    int32 MaxY = TNumericLimits< int32 >::Lowest();
+    LandscapeComponent->GetComponentExtent( MinX, MinY, MaxX, MaxY );
+
+    // The exported normals depend on the neighbouring heights, so the ring of vertices around the
+    // component is hashed too, clamped to the landscape's extent.
+    int32 LandscapeMinX = 0, LandscapeMinY = 0, LandscapeMaxX = 0, LandscapeMaxY = 0;
+    if ( LandscapeInfo->GetLandscapeExtent( LandscapeMinX, LandscapeMinY, LandscapeMaxX, LandscapeMaxY ) )
+    {
+        MinX = FMath::Max( MinX - 1, LandscapeMinX );
+        MinY = FMath::Max( MinY - 1, LandscapeMinY );
+        MaxX = FMath::Min( MaxX + 1, LandscapeMaxX );
+        MaxY = FMath::Min( MaxY + 1, LandscapeMaxY );
+    }
+
+    TArray< uint16 > HeightData;
+    HeightData.SetNumZeroed( ( MaxX - MinX + 1 ) * ( MaxY - MinY + 1 ) );
+
+    FLandscapeEditDataInterface LandscapeEdit( LandscapeInfo );
+    LandscapeEdit.GetHeightDataFast( MinX, MinY, MaxX, MaxY, HeightData.GetData(), 0 );
+
+    return FCrc::MemCrc32( HeightData.GetData(), HeightData.Num() * sizeof( uint16 ), Hash );
+}
+
+#endif
+
 
 /*
 ALandscape *
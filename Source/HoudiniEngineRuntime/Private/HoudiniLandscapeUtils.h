@@ -46,6 +46,17 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
             int32& NumberOfQuadsPerSection,
             FVector& LandscapeResizeFactor );
 
+        // Pads the HeightData to whole landscape components without resampling, used for tiled landscapes
+        // which are not bound by the component count limit of a single landscape.
+        static bool ResizeHeightDataForLandscapeTiles(
+            TArray< uint16 >& HeightData,
+            int32& SizeX, int32& SizeY,
+            int32& NumberOfSectionsPerComponent,
+            int32& NumberOfQuadsPerSection );
+
+        // Returns true if a heightfield of that size should be imported as tiles of the given size
+        static bool ShouldTileLandscape( const HAPI_VolumeInfo& VolumeInfo, int32& TileSize );
+
         // Resizes LayerData so that it fits the Landscape size
         static bool ResizeLayerDataForLandscape(
             TArray< uint8 >& LayerData,
@@ -68,30 +79,90 @@ struct HOUDINIENGINERUNTIME_API FHoudiniLandscapeUtils
             const TArray< const FHoudiniGeoPartObject* >& InHeightfieldArray,
             float& fGlobalMin, float& fGlobalMax );
 
-        // Extract the float values of a given heightfield
-        static bool ExtractHeightfieldData(
+        // Retrieves and validates the VolumeInfo of a heightfield or heightfield layer
+        static bool GetHeightfieldVolumeInfo(
+            const FHoudiniGeoPartObject& Heightfield,
+            HAPI_VolumeInfo& VolumeInfo );
+
+        // Reads the heightfield by chunks of whole rows, and calls RowsFunction with the values of each chunk.
+        // RowsFunction runs on a worker while the next chunk is read, one chunk at a time and in order.
+        static bool ForEachHeightfieldRows(
             const FHoudiniGeoPartObject& Heightfield,
-            TArray< float >& FloatValues,
-            HAPI_VolumeInfo& VolumeInfo,
+            const HAPI_VolumeInfo& VolumeInfo,
+            TFunctionRef< void( int32 YStart, int32 YCount, const float * RowValues ) > RowsFunction );
+
+        // Returns the min/max values of a heightfield, without having to read all its values at once
+        static bool GetHeightfieldMinMax(
+            const FHoudiniGeoPartObject& Heightfield,
+            const HAPI_VolumeInfo& VolumeInfo,
             float& FloatMin, float& FloatMax );
 
-        // Converts the Houdini Float height values to Unreal uint16
-        static bool ConvertHeightfieldDataToLandscapeData(
-            const TArray< float >& HeightfieldFloatValues,
-            const HAPI_VolumeInfo& HeightfieldVolumeInfo,
+        // Returns the min/max of the heightfield values, computed in parallel
+        static bool GetHeightfieldDataMinMax(
+            const TArray< float >& FloatValues,
+            float& FloatMin, float& FloatMax );
+
+        // Quantizes the Houdini float height values to uint16 and transposes them to Unreal's order
+        static void QuantizeHeightfieldData(
+            const float * HeightfieldFloatValues,
+            const int32& HoudiniXSize, const int32& HoudiniYSize,
             const float& FloatMin, const float& FloatMax,
+            TArray< uint16 >& IntHeightData );
+
+        // Streams the heightfield and converts it to Unreal uint16 height values, then resizes them.
+        // The heightfield's own range is used for the conversion, unless GlobalMin and GlobalMax differ.
+        static bool ExtractHeightfieldLandscapeData(
+            const FHoudiniGeoPartObject& Heightfield,
+            const HAPI_VolumeInfo& HeightfieldVolumeInfo,
+            const float& GlobalMin, const float& GlobalMax,
             TArray< uint16 >& IntHeightData,
             FTransform& LandscapeTransform,
             int32& FinalXSize, int32& FinalYSize,
             int32& NumSectionPerLandscapeComponent,
-            int32& NumQuadsPerLandscapeSection );
+            int32& NumQuadsPerLandscapeSection,
+            bool bTiled = false );
 
-        static bool ConvertHeightfieldLayerToLandscapeLayer(
-            const TArray< float >& FloatLayerData,
-            const int32& LayerXSize, const int32& LayerYSize,
-            const float& LayerMin, const float& LayerMax,
+        // Resizes converted uint16 height values to UE4's size requirements and computes the landscape's transform
+        static bool FinalizeLandscapeHeightData(
+            TArray< uint16 >& IntHeightData,
+            const HAPI_VolumeInfo& HeightfieldVolumeInfo,
+            const float& FloatMin, const float& FloatMax,
+            FTransform& LandscapeTransform,
+            int32& FinalXSize, int32& FinalYSize,
+            int32& NumSectionPerLandscapeComponent,
+            int32& NumQuadsPerLandscapeSection,
+            bool bTiled );
+
+        // Streams the layer and converts it to Unreal uint8 weight values resized to the landscape.
+        // Flat layers ( LayerMin == LayerMax ) are not converted and leave LayerData empty.
+        static bool ExtractHeightfieldLayerData(
+            const FHoudiniGeoPartObject& Layer,
+            const HAPI_VolumeInfo& LayerVolumeInfo,
             const int32& LandscapeXSize, const int32& LandscapeYSize,
-            TArray< uint8 >& LayerData );
+            TArray< uint8 >& LayerData,
+            float& LayerMin, float& LayerMax );
+
+#if WITH_EDITOR
+        // Returns true if the landscape has the same size, component layout and transform, and can be updated in place
+        static bool CanUpdateLandscape(
+            ALandscape * Landscape,
+            const int32& XSize, const int32& YSize,
+            const int32& NumSectionPerLandscapeComponent,
+            const int32& NumQuadsPerLandscapeSection,
+            const FTransform& LandscapeTransform );
+
+        // Writes the height and layer data to an existing landscape, only updating the components whose data changed.
+        // Fails if the landscape's layers don't match ImportLayerInfos.
+        static bool UpdateLandscapeData(
+            ALandscape * Landscape,
+            const TArray< uint16 >& IntHeightData,
+            const TArray< FLandscapeImportLayerInfo >& ImportLayerInfos,
+            const int32& XSize, const int32& YSize );
+
+        // Returns a hash of the landscape component's heights, transform and override materials (and lightmap if
+        // requested), used by landscape inputs to only upload the components that changed.
+        static uint32 GetLandscapeComponentHash( ULandscapeComponent * LandscapeComponent, const bool& bHashLighting );
+#endif
 
         /*
         // Duplicate a given Landscape. This will create a new package for it. This will also create necessary
@@ -93,6 +93,59 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
             CurrentParametersByName.Add( ParmPair.Value->GetParameterName(), ParmPair.Value );
         }
 
+        // Index of each parameter in the parm infos, used to walk up the parameter tree.
+        TMap< HAPI_ParmId, int32 > ParmIndicesById;
+        ParmIndicesById.Reserve( NodeInfo.parmCount );
+        for( int32 ParamIdx = 0; ParamIdx < NodeInfo.parmCount; ++ParamIdx )
+            ParmIndicesById.Add( ParmInfos[ ParamIdx ].id, ParamIdx );
+
+        // Whether each parameter is hidden by one of its parent folders. Each parameter's state is resolved once
+        // and reused by all its descendants, which keeps the pass linear in the number of parameters.
+        enum class EParmFolderVisibility : uint8 { Unknown, Visible, Hidden };
+        TArray< EParmFolderVisibility > ParmFolderVisibilities;
+        ParmFolderVisibilities.Init( EParmFolderVisibility::Unknown, NodeInfo.parmCount );
+
+        TArray< int32 > UnresolvedParmIndices;
+        for( int32 ParamIdx = 0; ParamIdx < NodeInfo.parmCount; ++ParamIdx )
+        {
+            // Walk up to the first ancestor whose state is known, an invisible folder or the root.
+            EParmFolderVisibility Visibility = EParmFolderVisibility::Visible;
+            int32 CurrentIdx = ParamIdx;
+            while( ParmFolderVisibilities[ CurrentIdx ] == EParmFolderVisibility::Unknown )
+            {
+                UnresolvedParmIndices.Add( CurrentIdx );
+
+                HAPI_ParmId ParentId = ParmInfos[ CurrentIdx ].parentId;
+                if( ParentId <= 0 )
+                    break;
+
+                const int32 * ParentIdx = ParmIndicesById.Find( ParentId );
+                if( !ParentIdx || UnresolvedParmIndices.Num() > NodeInfo.parmCount )
+                {
+                    HOUDINI_LOG_ERROR( TEXT( "Could not find parent of parameter %d" ), ParmInfos[ CurrentIdx ].id );
+                    Visibility = EParmFolderVisibility::Hidden;
+                    break;
+                }
+
+                const HAPI_ParmInfo & ParentInfo = ParmInfos[ *ParentIdx ];
+                if( ParentInfo.invisible && ParentInfo.type == HAPI_PARMTYPE_FOLDER )
+                {
+                    Visibility = EParmFolderVisibility::Hidden;
+                    break;
+                }
+
+                CurrentIdx = *ParentIdx;
+            }
+
+            if( ParmFolderVisibilities[ CurrentIdx ] != EParmFolderVisibility::Unknown )
+                Visibility = ParmFolderVisibilities[ CurrentIdx ];
+
+            for( int32 UnresolvedIdx : UnresolvedParmIndices )
+                ParmFolderVisibilities[ UnresolvedIdx ] = Visibility;
+
+            UnresolvedParmIndices.Reset();
+        }
+
         // Create properties for parameters.
         for( int32 ParamIdx = 0; ParamIdx < NodeInfo.parmCount; ++ParamIdx )
         {
@@ -110,27 +163,8 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
             if( ParmInfo.invisible )
                 continue;
 
-            // Check if any parent folder of this parameter is invisible 
-            bool SkipParm = false;
-            HAPI_ParmId ParentId = ParmInfo.parentId;
-            while( ParentId > 0 && !SkipParm )
-            {
-                if( const HAPI_ParmInfo* ParentInfoPtr = ParmInfos.FindByPredicate( [=]( const HAPI_ParmInfo& Info ) {
-                    return Info.id == ParentId;
-                } ) )
-                {
-                    if( ParentInfoPtr->invisible && ParentInfoPtr->type == HAPI_PARMTYPE_FOLDER )
-                        SkipParm = true;
-                    ParentId = ParentInfoPtr->parentId;
-                }
-                else
-                {
-                    HOUDINI_LOG_ERROR( TEXT( "Could not find parent of parameter %d" ), ParmInfo.id );
-                    SkipParm = true;
-                }
-            }
-
-            if( SkipParm )
+            // Skip parameters in invisible folders.
+            if( ParmFolderVisibilities[ ParamIdx ] == EParmFolderVisibility::Hidden )
                 continue;
 
             UHoudiniAssetParameter * HoudiniAssetParameter = nullptr;
@@ -430,4 +464,121 @@ FHoudiniParamUtils::Build( HAPI_NodeId AssetId, class UObject* PrimaryObject,
     return true;
 }
 
+bool
+FHoudiniParamUtils::GetParameterLayoutHash( HAPI_NodeId AssetId, uint32 & OutLayoutHash )
+{
+    OutLayoutHash = 0;
+
+    if( !FHoudiniEngineUtils::IsValidAssetId( AssetId ) )
+        return false;
 
+    HAPI_AssetInfo AssetInfo;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAssetInfo(
+        FHoudiniEngine::Get().GetSession(), AssetId, &AssetInfo ), false );
+
+    HAPI_NodeInfo NodeInfo;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetNodeInfo(
+        FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, &NodeInfo ), false );
+
+    uint32 LayoutHash = HashCombine( GetTypeHash( AssetInfo.nodeId ), GetTypeHash( NodeInfo.parmCount ) );
+
+    if( NodeInfo.parmCount > 0 )
+    {
+        TArray< HAPI_ParmInfo > ParmInfos;
+        ParmInfos.SetNumUninitialized( NodeInfo.parmCount );
+        HOUDINI_CHECK_ERROR_RETURN(
+            FHoudiniApi::GetParameters(
+                FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, &ParmInfos[ 0 ], 0,
+                NodeInfo.parmCount ), false );
+
+        for( const HAPI_ParmInfo & ParmInfo : ParmInfos )
+        {
+            LayoutHash = HashCombine( LayoutHash, GetTypeHash( ParmInfo.id ) );
+            LayoutHash = HashCombine( LayoutHash, GetTypeHash( ParmInfo.parentId ) );
+            LayoutHash = HashCombine( LayoutHash, GetTypeHash( ParmInfo.childIndex ) );
+            LayoutHash = HashCombine( LayoutHash, GetTypeHash( (int32) ParmInfo.type ) );
+            LayoutHash = HashCombine( LayoutHash, GetTypeHash( ParmInfo.size ) );
+            LayoutHash = HashCombine( LayoutHash, GetTypeHash( ParmInfo.choiceCount ) );
+            LayoutHash = HashCombine( LayoutHash, GetTypeHash( (int32) ParmInfo.rampType ) );
+            LayoutHash = HashCombine( LayoutHash, GetTypeHash( (int32) ParmInfo.inputNodeType ) );
+            LayoutHash = HashCombine( LayoutHash, GetTypeHash( ParmInfo.instanceCount ) );
+            LayoutHash = HashCombine( LayoutHash, GetTypeHash( ParmInfo.instanceNum ) );
+
+            const uint32 ParmFlags =
+                ( ParmInfo.invisible ? 1 : 0 ) | ( ParmInfo.disabled ? 2 : 0 ) |
+                ( ParmInfo.spare ? 4 : 0 ) | ( ParmInfo.isChildOfMultiParm ? 8 : 0 );
+            LayoutHash = HashCombine( LayoutHash, ParmFlags );
+        }
+    }
+
+    OutLayoutHash = LayoutHash;
+    return true;
+}
+
+bool
+FHoudiniParamUtils::RefreshValues( HAPI_NodeId AssetId,
+    const TMap< HAPI_ParmId, UHoudiniAssetParameter * >& Parameters, bool & bOutValuesChanged )
+{
+    bOutValuesChanged = false;
+
+    if( !FHoudiniEngineUtils::IsValidAssetId( AssetId ) )
+        return false;
+
+    HAPI_AssetInfo AssetInfo;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetAssetInfo(
+        FHoudiniEngine::Get().GetSession(), AssetId, &AssetInfo ), false );
+
+    HAPI_NodeInfo NodeInfo;
+    HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetNodeInfo(
+        FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, &NodeInfo ), false );
+
+    // Retrieve the values of all the parameters, one call per value type.
+    TArray< int32 > IntValues;
+    IntValues.SetNumZeroed( NodeInfo.parmIntValueCount );
+    if( NodeInfo.parmIntValueCount > 0 )
+    {
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmIntValues(
+            FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId,
+            &IntValues[ 0 ], 0, NodeInfo.parmIntValueCount ), false );
+    }
+
+    TArray< float > FloatValues;
+    FloatValues.SetNumZeroed( NodeInfo.parmFloatValueCount );
+    if( NodeInfo.parmFloatValueCount > 0 )
+    {
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmFloatValues(
+            FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId,
+            &FloatValues[ 0 ], 0, NodeInfo.parmFloatValueCount ), false );
+    }
+
+    TArray< HAPI_StringHandle > StringValues;
+    StringValues.SetNumZeroed( NodeInfo.parmStringValueCount );
+    if( NodeInfo.parmStringValueCount > 0 )
+    {
+        HOUDINI_CHECK_ERROR_RETURN( FHoudiniApi::GetParmStringValues(
+            FHoudiniEngine::Get().GetSession(), AssetInfo.nodeId, false,
+            &StringValues[ 0 ], 0, NodeInfo.parmStringValueCount ), false );
+    }
+
+    TSet< UHoudiniAssetParameter * > ChangedParentParameters;
+    for( const auto& ParmPair : Parameters )
+    {
+        UHoudiniAssetParameter * Parameter = ParmPair.Value;
+        if( !Parameter || Parameter->HasChanged() )
+            continue;
+
+        if( Parameter->RefreshParameterValue( IntValues, FloatValues, StringValues ) )
+        {
+            bOutValuesChanged = true;
+
+            if( UHoudiniAssetParameter * ParentParameter = Parameter->GetParentParameter() )
+                ChangedParentParameters.Add( ParentParameter );
+        }
+    }
+
+    // Parameters built from their children, like ramps, are updated as when their children are created.
+    for( UHoudiniAssetParameter * ParentParameter : ChangedParentParameters )
+        ParentParameter->NotifyChildParametersCreated();
+
+    return true;
+}
@@ -40,4 +40,22 @@ struct HOUDINIENGINERUNTIME_API FHoudiniParamUtils
     static bool Build( HAPI_NodeId AssetId, class UObject* PrimaryObject, 
         TMap< HAPI_ParmId, class UHoudiniAssetParameter * >& CurrentParameters,
         TMap< HAPI_ParmId, class UHoudiniAssetParameter * >& NewParameters );
+
+    /** Compute a fingerprint of the parameter layout of the asset, parameter values are not part of it.
+    @AssetId: Id of the digital asset
+    @OutLayoutHash: hash of the ids, types, sizes, tree links, flags and multiparm counts of the parameters
+
+    On Return: false if the parameters could not be retrieved.
+    */
+    static bool GetParameterLayoutHash( HAPI_NodeId AssetId, uint32 & OutLayoutHash );
+
+    /** Refresh the values of parameters whose layout didn't change, fetching the values of all of them at once.
+    @AssetId: Id of the digital asset
+    @Parameters: current parameters, the ones with changes not uploaded yet are left as they are
+    @bOutValuesChanged: true if any parameter value has been updated
+
+    On Return: false if the values could not be retrieved.
+    */
+    static bool RefreshValues( HAPI_NodeId AssetId,
+        const TMap< HAPI_ParmId, class UHoudiniAssetParameter * >& Parameters, bool & bOutValuesChanged );
 };
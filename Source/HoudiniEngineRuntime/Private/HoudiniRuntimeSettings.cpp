@@ -81,6 +81,11 @@ UHoudiniRuntimeSettings::UHoudiniRuntimeSettings( const FObjectInitializer & Obj
     MarshallingAttributeInputMeshName = TEXT( HAPI_UNREAL_ATTRIB_INPUT_MESH_NAME );
     MarshallingSplineResolution = HAPI_UNREAL_PARAM_SPLINE_RESOLUTION_DEFAULT;
     MarshallingLandscapesUseFullResolution = false;
+    MarshallingLandscapesTileSize = HAPI_UNREAL_LANDSCAPE_TILE_SIZE_DEFAULT;
+    bMarshallingUseGeometryBuffer = true;
+
+    /** Instancing options. **/
+    bUseHierarchicalInstancers = false;
 
     /** Geometry scaling. **/
     GeneratedGeometryScaleFactor = HAPI_UNREAL_SCALE_FACTOR_POSITION;
@@ -268,6 +268,25 @@ class HOUDINIENGINERUNTIME_API UHoudiniRuntimeSettings : public UObject
         UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling)
         bool MarshallingLandscapesUseFullResolution;
 
+        // Heightfields larger than this size (in points per side) are split into tiles of that size,
+        // each tile being imported as a landscape streaming proxy. Zero disables tiling.
+        UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling, Meta = ( ClampMin = "0" ) )
+        int32 MarshallingLandscapesTileSize;
+
+        // If true, mesh and landscape inputs are sent to Houdini as a single geometry buffer
+        // instead of one call per attribute, for socket and pipe sessions only. The buffer is ASCII,
+        // so it is larger than the attribute data, in process sessions keep the per attribute calls.
+        UPROPERTY(GlobalConfig, EditAnywhere, Category = GeometryMarshalling)
+        bool bMarshallingUseGeometryBuffer;
+
+    /** Instancing options. **/
+    public:
+
+        // If true, instancers will generate hierarchical instanced static mesh components, which are culled per cluster.
+        // Can be enabled per instancer with the unreal_hierarchical_instancer attribute.
+        UPROPERTY( GlobalConfig, EditAnywhere, Category = Instancing )
+        bool bUseHierarchicalInstancers;
+
     /** Geometry scaling. **/
     public:
 
@@ -21,6 +21,8 @@
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngineRuntimeTest.h"
 #include "HoudiniAssetParameterInt.h"
+#include "HoudiniLandscapeUtils.h"
+#include "HoudiniGeoEncoder.h"
 
 DEFINE_LOG_CATEGORY_STATIC( LogHoudiniTests, Log, All );
 
@@ -30,6 +32,9 @@ IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeMeshMarshalTest, "Houdini
 IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeUploadStaticMeshTest, "Houdini.Runtime.UploadStaticMesh", kTestFlags )
 IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeActorTest, "Houdini.Runtime.ActorTest", kTestFlags )
 IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeParamTest, "Houdini.Runtime.ParamTest", kTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeLandscapeConversionTest, "Houdini.Runtime.LandscapeConversionBenchmark", kTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeGeoEncoderTest, "Houdini.Runtime.GeoEncoderTest", kTestFlags )
+IMPLEMENT_SIMPLE_AUTOMATION_TEST( FHoudiniEngineRuntimeHeightfieldLayoutTest, "Houdini.Runtime.HeightfieldLayoutTest", kTestFlags )
 
 static float TestTickDelay = 1.0f;
 
@@ -94,6 +99,12 @@ struct FTestCookHandler : public FHoudiniCookParams, public IHoudiniCookHandler
         return nullptr;
     }
 
+    virtual class UMaterialInterface * LoadAttributeMaterial( const FString& MaterialPath ) override
+    {
+        return Cast< UMaterialInterface >( StaticLoadObject(
+            UMaterialInterface::StaticClass(), nullptr, *MaterialPath, nullptr, LOAD_NoWarn, nullptr ) );
+    }
+
 };
 
 struct FHVert
@@ -463,8 +474,9 @@ bool FHoudiniEngineRuntimeUploadStaticMeshTest::RunTest( const FString& Paramete
         }
 
         TArray<UObject *> InputObjects;
-        HAPI_NodeId ConnectedAssetId;
+        HAPI_NodeId ConnectedAssetId = -1;
         TArray< HAPI_NodeId > GeometryInputAssetIds;
+        TArray< uint32 > GeometryInputMeshKeys;
 
         UStaticMesh * GeoInput = Cast<UStaticMesh>( StaticLoadObject(
                 UObject::StaticClass(), nullptr, TEXT( "StaticMesh'/Engine/BasicShapes/Cube.Cube'" ), nullptr, LOAD_None, nullptr ));
@@ -475,7 +487,7 @@ bool FHoudiniEngineRuntimeUploadStaticMeshTest::RunTest( const FString& Paramete
 
         InputObjects.Add( GeoInput );
 
-        if( ! FHoudiniEngineUtils::HapiCreateInputNodeForData( AssetId, InputObjects, ConnectedAssetId, GeometryInputAssetIds ) )
+        if( ! FHoudiniEngineUtils::HapiCreateInputNodeForData( AssetId, InputObjects, ConnectedAssetId, GeometryInputAssetIds, GeometryInputMeshKeys ) )
         {
             AddError( FString::Printf( TEXT( "HapiCreateInputNodeForData failed" )));
         }
@@ -632,4 +644,235 @@ bool FHoudiniEngineRuntimeMeshMarshalTest::RunTest( const FString& Parameters )
     return true;
 }
 
-#endif // WITH_EDITOR
\ No newline at end of file
+bool FHoudiniEngineRuntimeLandscapeConversionTest::RunTest( const FString& Parameters )
+{
+    // 4k and 8k heightfields, sized like the landscapes they produce
+    const int32 TestSizes[] = { 4033, 8129 };
+    for ( int32 Size : TestSizes )
+    {
+        const int32 HoudiniXSize = Size;
+        const int32 HoudiniYSize = Size + 64;
+        const int32 NumPoints = HoudiniXSize * HoudiniYSize;
+
+        TArray< float > FloatValues;
+        FloatValues.SetNumUninitialized( NumPoints );
+        for ( int32 n = 0; n < NumPoints; n++ )
+        {
+            const float X = (float)( n % HoudiniXSize );
+            const float Y = (float)( n / HoudiniXSize );
+            FloatValues[ n ] = FMath::Sin( X * 0.013f ) * 50.0f + FMath::Cos( Y * 0.007f ) * 120.0f + X * 0.001f;
+        }
+
+        // Reference min/max and quantization, matching the original scalar conversion
+        double StartTime = FPlatformTime::Seconds();
+        float RefMin = FloatValues[ 0 ], RefMax = FloatValues[ 0 ];
+        for ( int32 n = 0; n < NumPoints; n++ )
+        {
+            RefMin = FMath::Min( RefMin, FloatValues[ n ] );
+            RefMax = FMath::Max( RefMax, FloatValues[ n ] );
+        }
+
+        double DigitZRange = 49152.0;
+        const UHoudiniRuntimeSettings * HoudiniRuntimeSettings = GetDefault< UHoudiniRuntimeSettings >();
+        if ( HoudiniRuntimeSettings && HoudiniRuntimeSettings->MarshallingLandscapesUseFullResolution )
+            DigitZRange = 65535.0;
+        double DigitCenterOffset = FMath::FloorToDouble( ( 65535.0 - DigitZRange ) / 2.0 );
+        double MeterZRange = (double)( RefMax - RefMin );
+        double ZSpacing = ( MeterZRange != 0.0 ) ? ( DigitZRange / MeterZRange ) : 0.0;
+
+        TArray< uint16 > RefHeightData;
+        RefHeightData.SetNumUninitialized( NumPoints );
+        const int32 XSize = HoudiniYSize;
+        const int32 YSize = HoudiniXSize;
+        for ( int32 nY = 0; nY < YSize; nY++ )
+        {
+            for ( int32 nX = 0; nX < XSize; nX++ )
+            {
+                double DoubleValue = (double)FloatValues[ nY + nX * HoudiniXSize ] - (double)RefMin;
+                RefHeightData[ nX + nY * XSize ] = FMath::RoundToInt( DoubleValue * ZSpacing + DigitCenterOffset );
+            }
+        }
+        double ReferenceTime = FPlatformTime::Seconds() - StartTime;
+
+        // Parallel min/max and blocked quantization
+        StartTime = FPlatformTime::Seconds();
+        float FloatMin = 0.0f, FloatMax = 0.0f;
+        FHoudiniLandscapeUtils::GetHeightfieldDataMinMax( FloatValues, FloatMin, FloatMax );
+        TArray< uint16 > IntHeightData;
+        FHoudiniLandscapeUtils::QuantizeHeightfieldData(
+            FloatValues.GetData(), HoudiniXSize, HoudiniYSize, FloatMin, FloatMax, IntHeightData );
+        double QuantizeTime = FPlatformTime::Seconds() - StartTime;
+
+        TestEqual( TEXT( "Min matches" ), FloatMin, RefMin );
+        TestEqual( TEXT( "Max matches" ), FloatMax, RefMax );
+        TestTrue( TEXT( "Height data is bit identical" ),
+            IntHeightData.Num() == RefHeightData.Num() &&
+            FMemory::Memcmp( IntHeightData.GetData(), RefHeightData.GetData(), RefHeightData.Num() * sizeof( uint16 ) ) == 0 );
+
+        // Resize to landscape components and transform computation
+        HAPI_VolumeInfo VolumeInfo{};
+        VolumeInfo.xLength = HoudiniXSize;
+        VolumeInfo.yLength = HoudiniYSize;
+        VolumeInfo.zLength = 1;
+        VolumeInfo.tupleSize = 1;
+        VolumeInfo.transform.rotationQuaternion[ 3 ] = 1.0f;
+        VolumeInfo.transform.scale[ 0 ] = VolumeInfo.transform.scale[ 1 ] = VolumeInfo.transform.scale[ 2 ] = 1.0f;
+
+        StartTime = FPlatformTime::Seconds();
+        FTransform LandscapeTransform;
+        int32 FinalXSize, FinalYSize, NumSectionPerLandscapeComponent, NumQuadsPerLandscapeSection;
+        TestTrue( TEXT( "FinalizeLandscapeHeightData" ),
+            FHoudiniLandscapeUtils::FinalizeLandscapeHeightData(
+                IntHeightData, VolumeInfo, FloatMin, FloatMax,
+                LandscapeTransform,
+                FinalXSize, FinalYSize,
+                NumSectionPerLandscapeComponent, NumQuadsPerLandscapeSection, false ) );
+        double ConvertTime = FPlatformTime::Seconds() - StartTime;
+
+        AddLogItem( FString::Printf(
+            TEXT( "%d x %d: reference %.3fs, min/max + quantize %.3fs, resize to %d x %d %.3fs" ),
+            HoudiniXSize, HoudiniYSize, ReferenceTime, QuantizeTime, FinalXSize, FinalYSize, ConvertTime ) );
+    }
+
+    return true;
+}
+
+bool FHoudiniEngineRuntimeHeightfieldLayoutTest::RunTest( const FString& Parameters )
+{
+    // A non-square landscape, with a height and a mask that both increase with the vertex index.
+    const int32 XSize = 7;
+    const int32 YSize = 4;
+    const int32 NumPoints = XSize * YSize;
+
+    TArray< float > HeightValues;
+    FHoudiniEngineUtils::ConvertLandscapeDataToHeightfieldData( XSize, YSize, [&]( int32 LandscapeIdx )
+    {
+        return (float)LandscapeIdx;
+    }, HeightValues );
+
+    TArray< float > MaskValues;
+    FHoudiniEngineUtils::ConvertLandscapeDataToHeightfieldData( XSize, YSize, [&]( int32 LandscapeIdx )
+    {
+        return (float)LandscapeIdx / (float)NumPoints;
+    }, MaskValues );
+
+    // Every volume has the same resolution and each voxel comes from the same vertex.
+    TestEqual( TEXT( "Height size" ), HeightValues.Num(), NumPoints );
+    TestEqual( TEXT( "Mask size" ), MaskValues.Num(), NumPoints );
+    bool bSameVoxels = true;
+    for ( int32 Idx = 0; Idx < NumPoints; Idx++ )
+        bSameVoxels &= FMath::IsNearlyEqual( MaskValues[ Idx ] * NumPoints, HeightValues[ Idx ], 0.01f );
+    TestTrue( TEXT( "Mask voxels match height voxels" ), bSameVoxels );
+
+    // The exported volume is ( YSize, XSize ), importing it back restores the landscape's vertex order.
+    TArray< uint16 > IntHeightData;
+    FHoudiniLandscapeUtils::QuantizeHeightfieldData(
+        HeightValues.GetData(), YSize, XSize, 0.0f, (float)( NumPoints - 1 ), IntHeightData );
+
+    bool bRoundTrip = IntHeightData.Num() == NumPoints;
+    for ( int32 Idx = 1; bRoundTrip && Idx < NumPoints; Idx++ )
+        bRoundTrip = IntHeightData[ Idx ] > IntHeightData[ Idx - 1 ];
+    TestTrue( TEXT( "Import restores the landscape's vertex order" ), bRoundTrip );
+
+    return true;
+}
+
+bool FHoudiniEngineRuntimeGeoEncoderTest::RunTest( const FString& Parameters )
+{
+    // Two triangles sharing an edge.
+    HAPI_PartInfo Part;
+    FMemory::Memzero< HAPI_PartInfo >( Part );
+    Part.type = HAPI_PARTTYPE_MESH;
+    Part.pointCount = 4;
+    Part.vertexCount = 6;
+    Part.faceCount = 2;
+
+    const float Positions[] = { 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.1f, 1.0f / 3.0f, 0.0f };
+    const float Normals[] = { 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 0.0f };
+    const int32 PrimitiveIds[] = { 7, 8 };
+    const int32 DetailValues[] = { 42 };
+    const int32 VertexList[] = { 0, 1, 2, 2, 1, 3 };
+    const int32 FaceCounts[] = { 3, 3 };
+
+    // Equal strings at different addresses have to be stored once.
+    const ANSICHAR MaterialA[] = "/Game/MatA";
+    const ANSICHAR MaterialACopy[] = "/Game/MatA";
+    const char * Materials[] = { MaterialA, MaterialACopy };
+
+    auto MakeAttributeInfo = []( HAPI_AttributeOwner Owner, HAPI_StorageType Storage, int32 Count, int32 TupleSize )
+    {
+        HAPI_AttributeInfo AttributeInfo;
+        FMemory::Memzero< HAPI_AttributeInfo >( AttributeInfo );
+        AttributeInfo.exists = true;
+        AttributeInfo.owner = Owner;
+        AttributeInfo.storage = Storage;
+        AttributeInfo.originalOwner = HAPI_ATTROWNER_INVALID;
+        AttributeInfo.count = Count;
+        AttributeInfo.tupleSize = TupleSize;
+        return AttributeInfo;
+    };
+
+    const HAPI_AttributeInfo PositionInfo = MakeAttributeInfo( HAPI_ATTROWNER_POINT, HAPI_STORAGETYPE_FLOAT, 4, 3 );
+    const HAPI_AttributeInfo NormalInfo = MakeAttributeInfo( HAPI_ATTROWNER_VERTEX, HAPI_STORAGETYPE_FLOAT, 6, 3 );
+    const HAPI_AttributeInfo PrimitiveIdInfo = MakeAttributeInfo( HAPI_ATTROWNER_PRIM, HAPI_STORAGETYPE_INT, 2, 1 );
+    const HAPI_AttributeInfo MaterialInfo = MakeAttributeInfo( HAPI_ATTROWNER_PRIM, HAPI_STORAGETYPE_STRING, 2, 1 );
+    const HAPI_AttributeInfo DetailInfo = MakeAttributeInfo( HAPI_ATTROWNER_DETAIL, HAPI_STORAGETYPE_INT, 1, 1 );
+
+    // Control characters have to be escaped.
+    const char * Labels[] = { "a\tb\"\n" };
+    const HAPI_AttributeInfo LabelInfo = MakeAttributeInfo( HAPI_ATTROWNER_DETAIL, HAPI_STORAGETYPE_STRING, 1, 1 );
+
+    // The encoder doesn't talk to HAPI until the geometry is committed.
+    FHoudiniGeoEncoder GeoEncoder( -1, true );
+    TestEqual( TEXT( "SetPartInfo" ), (int32) GeoEncoder.SetPartInfo( &Part ), (int32) HAPI_RESULT_SUCCESS );
+    TestEqual( TEXT( "P" ), (int32) GeoEncoder.SetAttributeFloatData( "P", &PositionInfo, Positions, 0, 4 ), (int32) HAPI_RESULT_SUCCESS );
+    TestEqual( TEXT( "N" ), (int32) GeoEncoder.SetAttributeFloatData( "N", &NormalInfo, Normals, 0, 6 ), (int32) HAPI_RESULT_SUCCESS );
+    TestEqual( TEXT( "id" ), (int32) GeoEncoder.SetAttributeIntData( "id", &PrimitiveIdInfo, PrimitiveIds, 0, 2 ), (int32) HAPI_RESULT_SUCCESS );
+    TestEqual( TEXT( "material" ), (int32) GeoEncoder.SetAttributeStringData( "material", &MaterialInfo, Materials, 0, 2 ), (int32) HAPI_RESULT_SUCCESS );
+    TestEqual( TEXT( "detail" ), (int32) GeoEncoder.SetAttributeIntData( "detail", &DetailInfo, DetailValues, 0, 1 ), (int32) HAPI_RESULT_SUCCESS );
+    TestEqual( TEXT( "label" ), (int32) GeoEncoder.SetAttributeStringData( "label", &LabelInfo, Labels, 0, 1 ), (int32) HAPI_RESULT_SUCCESS );
+    TestEqual( TEXT( "SetVertexList" ), (int32) GeoEncoder.SetVertexList( VertexList, 0, 6 ), (int32) HAPI_RESULT_SUCCESS );
+    TestEqual( TEXT( "SetFaceCounts" ), (int32) GeoEncoder.SetFaceCounts( FaceCounts, 0, 2 ), (int32) HAPI_RESULT_SUCCESS );
+
+    // Partial attribute data can't be encoded.
+    TestEqual( TEXT( "Partial data is rejected" ),
+        (int32) GeoEncoder.SetAttributeFloatData( "P", &PositionInfo, Positions, 1, 3 ), (int32) HAPI_RESULT_INVALID_ARGUMENT );
+
+    TArray< ANSICHAR > Buffer;
+    GeoEncoder.Encode( Buffer );
+    Buffer.Add( '\0' );
+    const FString Encoded = ANSI_TO_TCHAR( Buffer.GetData() );
+
+    auto TestContains = [ & ]( const TCHAR * What, const TCHAR * Expected )
+    {
+        TestTrue( What, Encoded.Contains( Expected, ESearchCase::CaseSensitive ) );
+    };
+
+    TestContains( TEXT( "Counts" ), TEXT( "\"pointcount\",4,\"vertexcount\",6,\"primitivecount\",2" ) );
+    TestContains( TEXT( "Topology" ), TEXT( "\"pointref\",[\"indices\",[0,1,2,2,1,3]]" ) );
+    TestContains( TEXT( "Point attributes" ), TEXT( "\"pointattributes\",[[[\"scope\",\"public\",\"type\",\"numeric\",\"name\",\"P\"]" ) );
+    TestContains( TEXT( "Positions" ), TEXT( "\"tuples\",[[0,0,0],[1,0,0],[0,1,0],[0.1,0.333333343,0]]" ) );
+    TestContains( TEXT( "Vertex attributes" ), TEXT( "\"vertexattributes\",[[[\"scope\",\"public\",\"type\",\"numeric\",\"name\",\"N\"]" ) );
+    TestContains( TEXT( "Primitive attributes" ), TEXT( "\"primitiveattributes\",[[[\"scope\",\"public\",\"type\",\"numeric\",\"name\",\"id\"]" ) );
+    TestContains( TEXT( "Primitive ids" ), TEXT( "\"arrays\",[[7,8]]" ) );
+    TestContains( TEXT( "Strings are stored once" ), TEXT( "\"strings\",[\"/Game/MatA\"],\"indices\",[\"size\",1,\"storage\",\"int32\",\"arrays\",[[0,0]]]" ) );
+    TestContains( TEXT( "Detail attributes" ), TEXT( "\"globalattributes\",[[[\"scope\",\"public\",\"type\",\"numeric\",\"name\",\"detail\"]" ) );
+    TestContains( TEXT( "Detail value" ), TEXT( "\"arrays\",[[42]]" ) );
+    TestContains( TEXT( "Escaped string" ), TEXT( "\"strings\",[\"a\\u0009b\\\"\\u000a\"]" ) );
+    TestContains( TEXT( "Primitives" ), TEXT( "\"Polygon_run\"],[\"startvertex\",0,\"nprimitives\",2,\"nvertices_rle\",[3,2]]" ) );
+
+    // Brackets have to be balanced for the buffer to load.
+    int32 Depth = 0;
+    for ( const ANSICHAR Char : Buffer )
+    {
+        if ( Char == '[' )
+            Depth++;
+        else if ( Char == ']' )
+            Depth--;
+    }
+    TestEqual( TEXT( "Balanced brackets" ), Depth, 0 );
+
+    return true;
+}
+
+#endif // WITH_EDITOR